@@ -9,110 +9,146 @@
 #include "globals.h"
 #include "symtab.h"
 #include "analyze.h"
+#include "util.h"
+#include "intern.h"
+#include "traverse.h"
 #include <stdio.h>
+#include <stdarg.h>
 /* counter for variable memory locations */
 static int location = 0;
 
+/* a scope being analyzed, with the scopes that
+ * enclose it
+ */
 typedef struct Stack
 {
-  char *scope;
+  Atom scope;
+  Atom func; /* the function the scope is in, if any */
   struct Stack *parent;
 } *StackPtr;
 StackPtr top = NULL;
 
-void make_header()
+/* atom of the global scope's name */
+static Atom globalScope = NOATOM;
+
+static void push(Atom scope, Atom func)
 {
-  if (top == NULL)
-  {
-    StackPtr tmp = (StackPtr)malloc(sizeof(struct Stack));
-    tmp->scope = "global";
-    tmp->parent = NULL;
-    top = tmp;
-    make_table(NULL, top->scope);
-    st_insert("global", "input", Integer, 0, 0);
-    st_insert("global", "output", Void, 0, 0);
-  }
+  StackPtr tmp = (StackPtr)malloc(sizeof(struct Stack));
+  tmp->scope = scope;
+  tmp->func = func;
+  tmp->parent = top;
+  top = tmp;
 }
 
-static void cycle()
+static void pop(void)
 {
   StackPtr tmp = top;
-  while (tmp != NULL)
+  top = top->parent;
+  free(tmp);
+}
+
+void make_header()
+{
+  if (top == NULL)
   {
-    tmp = tmp->parent;
+    ExpType value = Integer; /* the parameter of output */
+    globalScope = internString("global");
+    push(globalScope, NOATOM);
+    make_table(NOATOM, top->scope);
+    st_insert(globalScope, internString("input"), Integer, 0, 0);
+    setparams(internString("input"), 0, NULL);
+    st_insert(globalScope, internString("output"), Void, 0, 0);
+    setparams(internString("output"), 1, &value);
   }
 }
-static void push(char *scope, int lineno)
-{
-  char *newscope = (char *)malloc(sizeof(char) * 1000);
-  sprintf(newscope, "%s%d", scope, lineno);
 
-  make_table(top->scope, newscope);
+/* Procedure enterScope makes the scope opened by t,
+ * which opensScope, the current one. The scope is
+ * named after the function it is in and the NodeId
+ * of t, which no other scope shares and which every
+ * pass over the tree sees again, so each pass gives
+ * it the same name.
+ */
+static void enterScope(TreeNode *t)
+{
+  char buf[1000];
+  Atom func = t->nodekind == DclrK ? t->attr.name : top->func;
+  snprintf(buf, sizeof(buf), "%s@%d", atomName(func),
+           (int)(t - curTree->node));
+  push(internString(buf), func);
+}
 
-  StackPtr tmp = (StackPtr)malloc(sizeof(struct Stack));
-  tmp->scope = newscope;
-  tmp->parent = top;
-  top = tmp;
+static void exitScope(TreeNode *t)
+{
+  (void)t;
+  pop();
+}
 
-  cycle();
-};
+/* Procedure openScope is enterScope for the pass
+ * that builds the symbol table, which also makes
+ * the scope's table; closeScope closes it
+ */
+static void openScope(TreeNode *t)
+{
+  Atom parent = top->scope;
+  enterScope(t);
+  make_table(parent, top->scope);
+}
 
-static void pop(char *scope)
+static void closeScope(TreeNode *t)
 {
-  cycle();
-  cycle();
-  StackPtr tmp = top;
-  top = top->parent;
+  Atom scope = top->scope;
+  exitScope(t);
   delete_table(top->scope, scope);
+}
 
-  if (top == NULL)
-  {
-    top = tmp;
-    return;
-  }
-  free(tmp->scope);
-  free(tmp);
+/* paramCount returns the number of parameters of
+ * the function declared at t
+ */
+static int paramCount(TreeNode *t)
+{
+  int n = 0;
+  NodeId p;
+  for (p = t->child[1]; p != NONODE; p = NODE(p)->sibling)
+    if (NODE(p)->kind.prm != NullK)
+      n++;
+  return n;
 }
-/* Procedure traverse is a generic recursive
- * syntax tree traversal routine:
- * it applies preProc in preorder and postProc
- * in postorder to tree pointed to by t
+
+/* Procedure declareParams records the number and
+ * the types of the parameters of the function
+ * declared at t, for checking the calls to it
  */
-static void traverse(TreeNode *t,
-                     void (*preProc)(TreeNode *),
-                     void (*postProc)(TreeNode *))
+static void declareParams(TreeNode *t)
 {
-  if (t != NULL)
+  int n = paramCount(t), i = 0;
+  ExpType *types = malloc((n + 1) * sizeof(ExpType));
+  NodeId p;
+  if (types == NULL)
   {
-    preProc(t);
-    {
-      int i;
-      for (i = 0; i < MAXCHILDREN; i++)
-      {
-        // printf("i : %d\n",i);
-        traverse(t->child[i], preProc, postProc);
-      }
-    }
-    // printf("bot\n");
-    postProc(t);
-    traverse(t->sibling, preProc, postProc);
-    if ((t->nodekind == StmtK && t->kind.stmt == CompK) || (t->nodekind == DclrK && t->kind.dclr == FuncK))
-    {
-      pop(top->scope);
-    }
+    fprintf(listing, "Out of memory error at line %d\n", nodeLine(t));
+    exit(1);
   }
+  for (p = t->child[1]; p != NONODE; p = NODE(p)->sibling)
+    if (NODE(p)->kind.prm != NullK)
+      types[i++] = NODE(p)->type;
+  setparams(t->attr.name, n, types);
+  free(types);
 }
 
-/* nullProc is a do-nothing procedure to
- * generate preorder-only or postorder-only
- * traversals from traverse
+/* Procedure report prints an error the analyzer
+ * found, in the declarations or in the types, and
+ * marks the compilation as failed
  */
-static void nullProc(TreeNode *t)
+static void report(const char *format, ...)
 {
-  if (t == NULL)
-    return;
-  else
-    return;
+  va_list args;
+  va_start(args, format);
+  fprintf(listing, "Error: ");
+  vfprintf(listing, format, args);
+  fprintf(listing, "\n");
+  va_end(args);
+  Error = TRUE;
 }
 
 /* Procedure insertNode inserts
@@ -147,7 +183,6 @@ static void insertNode(TreeNode *t)
     case NonReturnK:
       break;
     case CompK:
-      push(top->scope, t->lineno);
       break;
     case AssignK:
       break;
@@ -181,46 +216,42 @@ static void insertNode(TreeNode *t)
       // int Type = st_lookup_excluding_parent(top->scope, t->attr.name);
       if (st_lookup_excluding_parent(top->scope, t->attr.name) != -1)
         /* not yet in table, so treat as new definition */
-        fprintf(listing, "Error: Symbol \"%s\" is redefined at line %d\n", t->attr.name, t->lineno);
+        report("Symbol \"%s\" is redefined at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
       else if (t->type == Void)
       {
 
-        fprintf(listing, "Error: The void-type variable is declared at line %d (name : \"%s\")\n", t->lineno, t->attr.name);
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, location++);
+        report("The void-type variable is declared at line %d, column %d (name : \"%s\")", nodeLine(t), nodeColumn(t), nodeName(t));
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
       }
       else
 
         /* already in table, so ignore location,
            add line number of use only */
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, location++);
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
       break;
     case ArrK: // cleared
       if (st_lookup_excluding_parent(top->scope, t->attr.name) != -1)
         /* not yet in table, so treat as new definition */
-        fprintf(listing, "Error: Symbol \"%s\" is redefined at line %d\n", t->attr.name, t->lineno);
+        report("Symbol \"%s\" is redefined at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
       else if (t->type != IntArr)
       {
-        fprintf(listing, "Error: The void-type variable is declared at line %d (name : \"%s\")\n", t->lineno, t->attr.name);
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, location++);
+        report("The void-type variable is declared at line %d, column %d (name : \"%s\")", nodeLine(t), nodeColumn(t), nodeName(t));
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
       }
       else
         /* already in table, so ignore location,
            add line number of use only */
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, location++);
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
       break;
     case FuncK: // cleared
       if (st_lookup_excluding_parent(top->scope, t->attr.name) != -1)
       {
-        fprintf(listing, "Error: Symbol \"%s\" is redefined at line %d\n", t->attr.name, t->lineno);
+        report("Symbol \"%s\" is redefined at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
       }
       else
       {
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, t->attr.val);
-        char *name = t->attr.name;
-        push(name, t->lineno);
-
-        // make_table(top->scope,t->attr.name);
-        // push(t->attr.name);
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
+        declareParams(t);
       }
 
       break;
@@ -234,20 +265,20 @@ static void insertNode(TreeNode *t)
     case NArrK: // cleared
       if (st_lookup_excluding_parent(top->scope, t->attr.name) != -1)
         /* not yet in table, so treat as new definition */
-        fprintf(listing, "Error: Symbol \"%s\" is redefined at line %d\n", t->attr.name, t->lineno);
+        report("Symbol \"%s\" is redefined at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
       else
         /* already in table, so ignore location,
            add line number of use only */
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, location++);
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
       break;
     case ArrPK: // cleared
       if (st_lookup_excluding_parent(top->scope, t->attr.name) != -1)
         /* not yet in table, so treat as new definition */
-        fprintf(listing, "Error: Symbol \"%s\" is redefined at line %d\n", t->attr.name, t->lineno);
+        report("Symbol \"%s\" is redefined at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
       else
         /* already in table, so ignore location,
            add line number of use only */
-        st_insert(top->scope, t->attr.name, t->type, t->lineno, location++);
+        st_insert(top->scope, t->attr.name, t->type, nodeLine(t), location++);
       break;
     case NullK:
       break;
@@ -261,14 +292,19 @@ static void insertNode(TreeNode *t)
   }
 }
 
+/* the symbol table is built in preorder, each
+ * declaration entered into the scope it is in
+ */
+static const Visitor symtabVisitor = {insertNode, NULL, openScope, closeScope};
+
 /* Function buildSymtab constructs the symbol
  * table by preorder traversal of the syntax tree
  */
 // need to MODIFY
-void buildSymtab(TreeNode *syntaxTree)
+void buildSymtab(NodeId syntaxTree)
 {
   make_header();
-  traverse(syntaxTree, insertNode, nullProc);
+  traverse(syntaxTree, &symtabVisitor);
   if (TraceAnalyze)
   {
     fprintf(listing, "\nSymbol table:\n\n");
@@ -276,12 +312,20 @@ void buildSymtab(TreeNode *syntaxTree)
   }
 }
 
-static void typeError(TreeNode *t, char *message)
+void declareSymbols(NodeId id)
 {
-  fprintf(listing, "Error: The void-type variable is declared at line %d (name : \"%s\")\n", t->lineno, t->attr.name);
-  // fprintf(listing,"Type error at line %d: %s\n",t->lineno,message);
-  Error = TRUE;
-  // Error = FALSE;
+  make_header();
+  traverseNode(id, &symtabVisitor);
+}
+
+void finishSymtab(void)
+{
+  make_header();
+  if (TraceAnalyze)
+  {
+    fprintf(listing, "\nSymbol table:\n\n");
+    printSymTab(listing);
+  }
 }
 
 /* Procedure checkNode performs
@@ -296,59 +340,47 @@ static void checkNode(TreeNode *t)
     switch (t->kind.stmt)
     {
     case IfK:
-      if (t->child[0]->type != Integer)
+      if (NODE(t->child[0])->type != Integer)
       {
-        fprintf(listing, "Error: Invalid condition at line %d\n", t->lineno);
+        report("Invalid condition at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       break;
     case ElseK:
-      if (t->child[0]->type != Integer)
+      if (NODE(t->child[0])->type != Integer)
       {
-        fprintf(listing, "Error: Invalid condition at line %d\n", t->lineno);
+        report("Invalid condition at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       break;
     case WhileK:
-      if (t->child[0]->type != Integer)
+      if (NODE(t->child[0])->type != Integer)
       {
-        fprintf(listing, "Error: Invalid condition at line %d\n", t->lineno);
+        report("Invalid condition at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       break;
     case ReturnK:
     { // Difficult
-      StackPtr tmp = top;
-      while (strcmp(tmp->parent->scope, "global") != 0)
+      int Type = st_lookup_excluding_parent(globalScope, top->func);
+      if (Type != t->type || NODE(t->child[0])->type != Integer)
       {
-        tmp = tmp->parent;
-      }
-      char *name = tmp->scope;
-      int Type = st_lookup_excluding_parent("global", name);
-      if (Type != t->type)
-      {
-        fprintf(listing, "Error: Invalid return at line %d\n", t->lineno);
+        report("Invalid return at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       break;
     }
     case NonReturnK: // Difficult
     {                // Difficult
-      StackPtr tmp = top;
-      while (strcmp(tmp->parent->scope, "global") != 0)
-      {
-        tmp = tmp->parent;
-      }
-      char *name = tmp->scope;
-      int Type = st_lookup_excluding_parent("global", name);
+      int Type = st_lookup_excluding_parent(globalScope, top->func);
       if (Type != t->type)
       {
-        fprintf(listing, "Error: Invalid return at line %d\n", t->lineno);
+        report("Invalid return at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       break;
     }
     case CompK:
       break;
     case AssignK:
-      if (t->child[0]->type != Integer || t->child[1]->type != Integer)
+      if (NODE(t->child[0])->type != Integer || NODE(t->child[1])->type != Integer)
       {
-        fprintf(listing, "Error: Invalid assignment at line %d\n", t->lineno);
+        report("Invalid assignment at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       else
         t->type = Integer;
@@ -358,14 +390,17 @@ static void checkNode(TreeNode *t)
     }
     break;
   case ExpK:
+  {
+    /* only IdK and ArrEK look their name up; attr
+     * holds an operator or a value in the others */
+    int Type = -1;
     switch (t->kind.exp)
     {
-      int Type = st_lookup(top->scope, t->attr.name);
 
     case OpK:
-      if (t->child[0]->type != Integer || t->child[1]->type != Integer)
+      if (NODE(t->child[0])->type != Integer || NODE(t->child[1])->type != Integer)
       {
-        fprintf(listing, "Error: Invalid assignment at line %d\n", t->lineno);
+        report("Invalid assignment at line %d, column %d", nodeLine(t), nodeColumn(t));
       }
       else
         t->type = Integer;
@@ -373,16 +408,17 @@ static void checkNode(TreeNode *t)
     case ConstK:
       break;
     case IdK:
+      Type = st_lookup(top->scope, nodeAtom(t));
       if (Type == -1)
       {
         int numparam = getnumparam(t->attr.name);
         if (numparam >= 0)
         {
-          fprintf(listing, "Error: Undeclared function \"%s\" is called at line %d\n", t->attr.name, t->lineno);
+          report("Undeclared function \"%s\" is called at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
         }
         else
         {
-          fprintf(listing, "Error: Undeclared variable \"%s\" is used at line %d\n", t->attr.name, t->lineno);
+          report("Undeclared variable \"%s\" is used at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
         }
       }
       else
@@ -392,51 +428,57 @@ static void checkNode(TreeNode *t)
 
       break;
     case ArrEK:
+      Type = st_lookup(top->scope, nodeAtom(t));
       if (Type == -1)
-        fprintf(listing, "Error: Undeclared variable \"%s\" is used at line %d\n", t->attr.name, t->lineno);
-      else if (t->child[0]->type != Integer)
+        report("Undeclared variable \"%s\" is used at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
+      else if (NODE(t->child[0])->type != Integer)
       {
-        fprintf(listing, "Error: Invalid array indexing at line %d (name : \"%s\"). Indices should be integer\n", lineno, t->attr.name);
+        report("Invalid array indexing at line %d, column %d (name : \"%s\"). Indices should be integer", nodeLine(t), nodeColumn(t), nodeName(t));
       }
       else if (Type != IntArr)
       {
-        fprintf(listing, "Error: Invalid array indexing at line %d (name : \"%s\"). Indexing can only be allowed for int[] variables\n", t->lineno, t->attr.name);
+        report("Invalid array indexing at line %d, column %d (name : \"%s\"). Indexing can only be allowed for int[] variables", nodeLine(t), nodeColumn(t), nodeName(t));
       }
-      else
-        t->type = Type;
+      /* an element of an int[] is an int, even when
+       * the index is wrong, so that the error is not
+       * reported again by the expression around it */
+      if (Type == IntArr)
+        t->type = Integer;
 
       break;
     case CallK:
-
-      if (st_lookup_excluding_parent("global", t->attr.name) == -1)
+    {
+      Atom name = nodeAtom(t);
+      int numparam = getnumparam(name);
+      Type = st_lookup_excluding_parent(globalScope, name);
+      if (Type == -1 || numparam == -1)
       {
-        fprintf(listing, "Error: Undeclared function \"%s\" is used at line %d\n", t->attr.name, t->lineno);
+        report("Undeclared function \"%s\" is used at line %d, column %d", nodeName(t), nodeLine(t), nodeColumn(t));
       }
-      else if (t->child[0] == NULL)
-      { // 파라미터없이 함수 콜
-        if (getnumparam(t->attr.name) != 0)
+      else
+      { /* the arguments have been checked, so each has
+         * its type; they must match the parameters */
+        NodeId arg = t->child[0];
+        int i = 0;
+        while (arg != NONODE && i < numparam &&
+               NODE(arg)->type == getparamtype(name, i))
         {
-          fprintf(listing, "Error: Invalid function call at line %d (name : \"%s\")\n", t->lineno, t->attr.name);
+          arg = NODE(arg)->sibling;
+          i++;
         }
-      }
-      else
-      {
-        TreeNode *tmp = t->child[0];
-        while (tmp != NULL)
+        if (arg != NONODE || i != numparam)
         {
-          if (st_lookup_excluding_parent(t, tmp->attr.name) == -1)
-          {
-            fprintf(listing, "Error: Invalid function call at line %d (name : \"%s\")\n", t->lineno, t->attr.name);
-            break;
-          }
-          tmp = tmp->sibling;
+          report("Invalid function call at line %d, column %d (name : \"%s\")", nodeLine(t), nodeColumn(t), nodeName(t));
         }
+        t->type = Type; /* what the function returns */
       }
       break;
+    }
     default:
       break;
     }
     break;
+  }
   case DclrK: // cleared
     switch (t->kind.dclr)
     {
@@ -466,11 +508,18 @@ static void checkNode(TreeNode *t)
   }
 }
 
+/* the types are checked in postorder, each node
+ * in the scope it is in, whose table buildSymtab
+ * has already made
+ */
+static const Visitor checkVisitor = {NULL, checkNode, enterScope, exitScope};
+
 /* Procedure typeCheck performs type checking
  * by a postorder syntax tree traversal
  */
 // need to MODIFY
-void typeCheck(TreeNode *syntaxTree)
+void typeCheck(NodeId syntaxTree)
 {
-  traverse(syntaxTree, nullProc, checkNode);
+  make_header();
+  traverse(syntaxTree, &checkVisitor);
 }
@@ -12,11 +12,21 @@
  * table by preorder traversal of the syntax tree
  */
 void make_header();
-void buildSymtab(TreeNode *);
+void buildSymtab(NodeId);
+
+/* Procedure declareSymbols enters the symbols of the
+ * one top-level declaration given into the symbol
+ * table, so that the table can be built as the parser
+ * completes declarations; finishSymtab closes it once
+ * the last has been entered. The table comes out as
+ * buildSymtab builds it from the whole tree.
+ */
+void declareSymbols(NodeId);
+void finishSymtab(void);
 
 /* Procedure typeCheck performs type checking 
  * by a postorder syntax tree traversal
  */
-void typeCheck(TreeNode *);
+void typeCheck(NodeId);
 
 #endif
@@ -0,0 +1,252 @@
+/****************************************************/
+/* File: astcache.c                                 */
+/* On-disk syntax tree cache for the C-Minus        */
+/* compiler                                         */
+/* A cache hit costs a hash of the source and one   */
+/* read of the node table, instead of a scan and a  */
+/* parse.                                           */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "intern.h"
+#include "compile.h"
+#include "astcache.h"
+#include <stdint.h>
+
+#define CACHEMAGIC "CMAST001"
+
+/* ORDER reads back differently on a machine of the
+ * other byte order, which then misses the cache
+ */
+#define ORDER 0x01020304u
+
+/* number of nodes saveTree renames at a time */
+#define NODEBATCH 1024
+
+typedef struct
+{
+  char magic[8];
+  uint32_t order;
+  uint32_t nodeSize; /* sizeof(TreeNode) */
+  uint64_t hash;     /* of the source text */
+  int32_t srcLen;    /* length of the source text */
+  int32_t count;     /* nodes, counting the NONODE */
+  int32_t root;
+  int32_t nnames;    /* names in the string table */
+  int32_t namesLen;  /* its length, each name ending in a NUL */
+  int32_t pad;
+} CacheHeader;
+
+/* hashText returns the 64-bit FNV-1a hash of the len
+ * bytes at s
+ */
+static uint64_t hashText(const char *s, int len)
+{
+  uint64_t h = 14695981039346656037ull;
+  int i;
+  for (i = 0; i < len; i++)
+  {
+    h ^= (unsigned char)s[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+/* linkOk checks that id names a node of a table of
+ * count nodes
+ */
+static int linkOk(NodeId id, int count)
+{
+  return id >= 0 && id < count;
+}
+
+/* kindOk checks that the kind and type bytes of t
+ * hold values of their enumerations
+ */
+static int kindOk(TreeNode *t)
+{
+  if (t->type > Null)
+    return FALSE;
+  switch (t->nodekind)
+  {
+  case StmtK:
+    return t->kind.stmt <= AssignK;
+  case ExpK:
+    return t->kind.exp <= CallK;
+  case DclrK:
+    return t->kind.dclr <= TypeK;
+  case ParamK:
+    return t->kind.prm <= NullK;
+  default:
+    return FALSE;
+  }
+}
+
+/* parentOk counts one more link to id in parents and
+ * checks that id has no other: every node of a tree
+ * but the root has exactly one parent or elder
+ * sibling, so a second link means the file does not
+ * hold a tree, and might hold a cycle
+ */
+static int parentOk(NodeId id, unsigned char *parents)
+{
+  return id == NONODE || parents[id]++ == 0;
+}
+
+int loadTree(const char *name, Compilation *cc)
+{
+  FILE *f = fopen(name, "rb");
+  CacheHeader h;
+  TreeNode *node = NULL;
+  char *names = NULL;
+  Atom *atoms = NULL;
+  unsigned char *parents = NULL;
+  int i, j, ok = FALSE;
+  if (f == NULL)
+    return FALSE;
+  if (fread(&h, sizeof(h), 1, f) != 1 ||
+      memcmp(h.magic, CACHEMAGIC, sizeof(h.magic)) != 0 ||
+      h.order != ORDER || h.nodeSize != sizeof(TreeNode) ||
+      h.srcLen != cc->source->len || h.count < 1 || h.nnames < 0 ||
+      h.namesLen < 0 || !linkOk(h.root, h.count) ||
+      h.hash != hashText(cc->source->text, cc->source->len))
+    goto done;
+  node = malloc(h.count * sizeof(TreeNode));
+  names = malloc(h.namesLen + 1);
+  atoms = malloc((h.nnames + 1) * sizeof(Atom));
+  parents = calloc(h.count, 1);
+  if (node == NULL || names == NULL || atoms == NULL || parents == NULL ||
+      fread(node, sizeof(TreeNode), h.count, f) != (size_t)h.count ||
+      fread(names, 1, h.namesLen, f) != (size_t)h.namesLen)
+    goto done;
+  names[h.namesLen] = '\0';
+  memset(node, 0, sizeof(TreeNode)); /* the NONODE */
+  for (i = 0, j = 0; i < h.nnames; i++)
+  {
+    int len = strlen(names + j);
+    if (j + len >= h.namesLen)
+      goto done;
+    atoms[i] = internName(names + j, len);
+    j += len + 1;
+  }
+  /* with no node linked to twice and none to the
+   * root, what can be reached from the root is a
+   * tree, so walking it ends */
+  for (i = 1; i < h.count; i++)
+  {
+    TreeNode *t = node + i;
+    Atom a;
+    if (!kindOk(t) || t->pos < 0 || t->pos > h.srcLen)
+      goto done;
+    for (j = 0; j < MAXCHILDREN; j++)
+      if (!linkOk(t->child[j], h.count) || !parentOk(t->child[j], parents))
+        goto done;
+    if (!linkOk(t->sibling, h.count) || !parentOk(t->sibling, parents))
+      goto done;
+    a = nodeAtom(t);
+    if (a != NOATOM)
+    {
+      if (a < 0 || a >= h.nnames)
+        goto done;
+      t->attr.name = atoms[a];
+    }
+  }
+  if (parents[h.root] != 0)
+    goto done;
+  freeNodes(&cc->nodes);
+  cc->nodes.node = node;
+  cc->nodes.count = cc->nodes.cap = h.count;
+  cc->tree = h.root;
+  cc->error = FALSE;
+  node = NULL;
+  ok = TRUE;
+done:
+  free(node);
+  free(names);
+  free(atoms);
+  free(parents);
+  fclose(f);
+  return ok;
+}
+
+int saveTree(const char *name, Compilation *cc)
+{
+  NodeTable *tab = &cc->nodes;
+  FILE *f;
+  CacheHeader h;
+  TreeNode batch[NODEBATCH];
+  int natoms = atomCount();
+  int *local; /* atom -> index in the string table */
+  Atom *order; /* index in the string table -> atom */
+  int i, j, ok;
+  if (tab->count == 0)
+    return FALSE;
+  local = malloc((natoms + 1) * sizeof(int));
+  order = malloc((natoms + 1) * sizeof(Atom));
+  if (local == NULL || order == NULL)
+  {
+    free(local);
+    free(order);
+    return FALSE;
+  }
+  for (i = 0; i < natoms; i++)
+    local[i] = -1;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, CACHEMAGIC, sizeof(h.magic));
+  h.order = ORDER;
+  h.nodeSize = sizeof(TreeNode);
+  h.hash = hashText(cc->source->text, cc->source->len);
+  h.srcLen = cc->source->len;
+  h.count = tab->count;
+  h.root = cc->tree;
+  for (i = 1; i < tab->count; i++)
+  {
+    Atom a = nodeAtom(tab->node + i);
+    if (a >= 0 && a < natoms)
+      local[a] = 0;
+  }
+  /* number the names in atom order, so that loadTree
+   * interns them in the order the scanner did and the
+   * symbol table comes out the same
+   */
+  for (i = 0; i < natoms; i++)
+    if (local[i] == 0)
+    {
+      order[h.nnames] = i;
+      local[i] = h.nnames++;
+      h.namesLen += strlen(atomName(i)) + 1;
+    }
+  f = fopen(name, "wb");
+  if (f == NULL)
+  {
+    free(local);
+    free(order);
+    return FALSE;
+  }
+  ok = fwrite(&h, sizeof(h), 1, f) == 1;
+  for (i = 0; ok && i < tab->count; i += NODEBATCH)
+  {
+    int n = tab->count - i < NODEBATCH ? tab->count - i : NODEBATCH;
+    memcpy(batch, tab->node + i, n * sizeof(TreeNode));
+    for (j = 0; j < n; j++)
+    {
+      Atom a = i + j == 0 ? NOATOM : nodeAtom(batch + j);
+      if (a >= 0 && a < natoms)
+        batch[j].attr.name = local[a];
+    }
+    ok = fwrite(batch, sizeof(TreeNode), n, f) == (size_t)n;
+  }
+  for (i = 0; ok && i < h.nnames; i++)
+  {
+    char *s = atomName(order[i]);
+    ok = fwrite(s, 1, strlen(s) + 1, f) == strlen(s) + 1;
+  }
+  free(local);
+  free(order);
+  if (fclose(f) != 0)
+    ok = FALSE;
+  if (!ok)
+    remove(name);
+  return ok;
+}
@@ -0,0 +1,30 @@
+/****************************************************/
+/* File: astcache.h                                 */
+/* On-disk syntax tree cache for the C-Minus        */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _ASTCACHE_H_
+#define _ASTCACHE_H_
+
+/* A cache file holds the node table of one parsed
+ * program together with a hash of the source it came
+ * from. Nodes refer to each other by index, so the
+ * table is written as it is; names are written as a
+ * string table and interned again when it is loaded.
+ */
+struct compilation;
+
+/* Function loadTree fills the syntax tree of cc from
+ * the cache file name if that holds the tree of the
+ * source of cc. Returns FALSE, leaving cc alone, if
+ * the file is missing, damaged or out of date.
+ */
+int loadTree(const char *name, struct compilation *cc);
+
+/* Function saveTree writes the syntax tree of cc to
+ * the cache file name. Returns FALSE if it fails.
+ */
+int saveTree(const char *name, struct compilation *cc);
+
+#endif
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Usage: bench.py SUITE...
+
+Times the compiler on programs made by gencm.py. The programs are
+written to bench/data the first time they are needed. Each case is
+run several times, and the best and the median time of the passes it
+measures are printed, as reported by --time, so that loading the
+program and starting up are left out. A case that measures "run"
+times the whole process instead.
+
+Suites:
+  parse     the yacc parser against the recursive-descent one
+  source    reading the program into memory against mapping it
+  lists     building long lists: the time per element must not grow
+            with the length of the list
+  keywords  reserved word lookup on a program made mostly of names
+  comments  the scanners on a program that is mostly comments
+  scale     the pre-scan and the parse on 1 to 8 threads
+"""
+
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+import gencm
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+DATA = os.path.join(HERE, 'data')
+BUILD = os.path.join(HERE, '..')
+RUNS = 7
+
+
+def program(shape, n):
+    """the path of the program gencm.py makes for shape and n"""
+    os.makedirs(DATA, exist_ok=True)
+    path = os.path.join(DATA, '%s%d.cm' % (shape, n))
+    if not os.path.exists(path):
+        with open(path, 'w') as f:
+            f.write(gencm.generate(shape, n))
+    return path
+
+
+def passTimes(compiler, args):
+    """runs compiler once with --time; returns {pass: ms},
+    with the time of the whole run as run"""
+    start = time.perf_counter()
+    r = subprocess.run([os.path.join(BUILD, compiler), '--time'] + args,
+                       stdout=subprocess.DEVNULL,
+                       stderr=subprocess.PIPE, universal_newlines=True)
+    times = {'run': (time.perf_counter() - start) * 1000}
+    for line in r.stderr.splitlines():
+        words = line.split()
+        if len(words) == 3 and words[2] == 'ms':
+            times[words[0]] = float(words[1])
+    return times
+
+
+def case(label, args, passes, compiler='cminus_semantic'):
+    """times the passes named in passes of a run of
+    compiler with args"""
+    runs = [passTimes(compiler, args) for _ in range(RUNS)]
+    total = [sum(t.get(p, 0) for p in passes) for t in runs]
+    print('  %-36s best %9.2f ms   median %9.2f ms'
+          % (label, min(total), statistics.median(total)))
+    return min(total)
+
+
+def heading(path):
+    print('%s (%d KB)' % (os.path.basename(path), os.path.getsize(path) // 1024))
+
+
+def parse():
+    for shape, n in [('funcs', 20000), ('stmts', 100000)]:
+        path = program(shape, n)
+        heading(path)
+        # the parse pass scans as it goes, unless the
+        # program has been pre-scanned
+        for parser in ['yacc', 'rd']:
+            case('--parser=%s (scan + parse)' % parser,
+                 ['--parse-only', '--parser=' + parser, path], ['parse'])
+        for parser in ['yacc', 'rd']:
+            case('--parser=%s --prescan (parse)' % parser,
+                 ['--parse-only', '--prescan', '--parser=' + parser, path],
+                 ['parse'])
+
+
+def lists():
+    for shape in ['stmts', 'decls']:
+        for n in [25000, 50000, 100000]:
+            path = program(shape, n)
+            heading(path)
+            for parser in ['yacc', 'rd']:
+                best = case('--parser=%s --prescan (parse)' % parser,
+                            ['--parse-only', '--prescan', '--parser=' + parser,
+                             path], ['parse'])
+                print('  %-36s %9.2f us per element' % ('', best * 1000 / n))
+
+
+def source():
+    for shape, n in [('funcs', 20000), ('funcs', 100000)]:
+        path = program(shape, n)
+        heading(path)
+        # the source is loaded before the first pass, so
+        # only the time of the whole run shows it
+        for label, args in [('mapped', []), ('read (--no-map)', ['--no-map'])]:
+            case(label + ' (run)', ['--lex-only'] + args + [path], ['run'])
+            case(label + ' (scan)', ['--lex-only'] + args + [path], ['scan'])
+
+
+def keywords():
+    path = program('idents', 20000)
+    heading(path)
+    # bench/kwbench looks up every word of the program,
+    # apart from the scanner that finds them
+    sys.stdout.flush()
+    subprocess.run([os.path.join(HERE, 'kwbench'), path])
+    # the hand-written scanner looks names up with
+    # keywordLookup; the others match reserved words
+    # in their automata
+    for compiler in ['cminus_cimpl', 'cminus_dfa', 'cminus_semantic']:
+        case(compiler, ['--lex-only', path], ['scan'], compiler)
+
+
+def comments():
+    path = program('comments', 20000)
+    heading(path)
+    for compiler in ['cminus_semantic', 'cminus_dfa', 'cminus_cimpl']:
+        case(compiler, ['--lex-only', path], ['scan'], compiler)
+
+
+def scale():
+    path = program('funcs', 20000)
+    heading(path)
+    # speed-ups past the number of cores only measure
+    # the cost of the extra threads
+    print('  (%d cores)' % os.cpu_count())
+    for option, stop, measured in [('--scan-threads', '--lex-only', 'scan'),
+                                   ('--parse-threads', '--parse-only', 'parse')]:
+        one = None
+        for n in [1, 2, 4, 8]:
+            best = case('%s=%d' % (option, n),
+                        [stop, '--prescan', '%s=%d' % (option, n), path],
+                        [measured])
+            one = one or best
+            print('  %-36s speed-up %.2f' % ('', one / best))
+
+
+SUITES = {'parse': parse, 'lists': lists, 'source': source, 'keywords': keywords,
+          'comments': comments, 'scale': scale}
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2 or any(s not in SUITES for s in sys.argv[1:]):
+        sys.exit(__doc__)
+    for s in sys.argv[1:]:
+        print('== %s' % s)
+        SUITES[s]()
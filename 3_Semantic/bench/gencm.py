@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Usage: gencm.py SHAPE N
+
+Writes a generated C-Minus program of size N to standard output, in
+one of these shapes:
+
+  funcs N   N functions, each mixing local declarations, loops,
+            conditions, calls and arithmetic
+  stmts N   one function of N statements
+  decls N   N global declarations and a function with N parameters
+            whose body calls it with N arguments
+  comments N
+            N short functions, each under a licence-sized block
+            comment, with short comments between the statements
+  idents N  N functions made mostly of identifiers, many of them
+            starting like, or as long as, a reserved word
+"""
+
+import sys
+
+
+def funcs(n):
+    out = ['int g[100];\n\n']
+    for i in range(n):
+        out.append('int f%d(int a, int b[])\n{\n'
+                   '  int i;\n  int s;\n'
+                   '  i = 0;\n  s = a;\n'
+                   '  while (i < %d) {\n'
+                   '    if (b[i] > s * 2 + 1) s = s + b[i] / (a - %d);\n'
+                   '    else { s = s - (i + g[i]) * 3; g[i] = s; }\n'
+                   '    i = i + 1;\n'
+                   '  }\n' % (i, i % 50 + 1, i))
+        if i > 0:
+            out.append('  s = s + f%d(s, b);\n' % (i - 1))
+        out.append('  return s;\n}\n\n')
+    out.append('void main(void)\n{\n  output(f%d(input(), g));\n}\n' % (n - 1))
+    return out
+
+
+def stmts(n):
+    out = ['int f(int a, int b[], int c)\n{\n']
+    out += ['  int v%d;\n' % i for i in range(200)]
+    out += ['  v%d = f(a, b, c + %d) + b[%d] * v%d;\n'
+            % (i % 200, i, i % 7, (i + 1) % 200) for i in range(n)]
+    out.append('  return v0;\n}\n\nvoid main(void)\n{\n  int b[7];\n'
+               '  output(f(input(), b, 0));\n}\n')
+    return out
+
+
+def decls(n):
+    out = ['int g%d;\n' % i for i in range(n)]
+    out.append('int f(%s)\n{\n  return 0;\n}\n\n'
+               % ', '.join('int p%d' % i for i in range(n)))
+    out.append('void main(void)\n{\n  f(%s);\n}\n'
+               % ', '.join('g%d' % i for i in range(n)))
+    return out
+
+
+LICENCE = ''.join(' * %s\n' % line for line in [
+    'Permission is hereby granted, free of charge, to any person',
+    'obtaining a copy of this software and associated documentation',
+    'files (the "Software"), to deal in the Software without',
+    'restriction, including without limitation the rights to use,',
+    'copy, modify, merge, publish, distribute, sublicense, and/or sell',
+    'copies of the Software, and to permit persons to whom the',
+    'Software is furnished to do so, subject to the following',
+    'conditions: ** the above notice shall be included ** in all',
+    'copies or substantial portions of the Software.'])
+
+
+def comments(n):
+    out = []
+    for i in range(n):
+        out.append('/*\n * f%d\n *\n%s */\nint f%d(int a)\n{\n'
+                   '  /* the argument, doubled */\n  a = a * 2;\n'
+                   '  /* *** and returned *** */\n  return a;\n}\n\n'
+                   % (i, LICENCE, i))
+    out.append('void main(void)\n{\n  output(f0(input()));\n}\n')
+    return out
+
+
+# names that share a length or a first letter with a
+# reserved word, so that a lookup cannot reject them
+# on either alone
+NAMES = ['iff', 'ifs', 'elsewhere', 'els', 'whiles', 'whale', 'returned',
+         'retain', 'integer', 'inx', 'voids', 'vol', 'item', 'index', 'x',
+         'counter', 'total', 'value', 'result', 'buffer']
+
+
+def idents(n):
+    out = []
+    for i in range(n):
+        a, b, c, d = (NAMES[(i + k * 7) % len(NAMES)] for k in range(4))
+        out.append('int %s%d(int %s, int %s[])\n{\n'
+                   '  int %s;\n'
+                   '  while (%s < %s) %s = %s + %s[%s];\n'
+                   '  if (%s == %s) return %s; else return %s;\n}\n\n'
+                   % (a, i, b, c, d, d, b, d, d, c, b, b, d, b, d))
+    out.append('void main(void)\n{\n  output(0);\n}\n')
+    return out
+
+
+SHAPES = {'funcs': funcs, 'stmts': stmts, 'decls': decls,
+          'comments': comments, 'idents': idents}
+
+
+def generate(shape, n):
+    return ''.join(SHAPES[shape](n))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3 or sys.argv[1] not in SHAPES:
+        sys.exit(__doc__)
+    sys.stdout.write(generate(sys.argv[1], int(sys.argv[2])))
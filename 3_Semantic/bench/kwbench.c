@@ -0,0 +1,130 @@
+/****************************************************/
+/* File: kwbench.c                                  */
+/* Times keywordLookup against the linear search of */
+/* the reserved words it replaced                   */
+/* usage: kwbench <program> [rounds]                */
+/* Every identifier-shaped word of the program is   */
+/* looked up rounds times by each; the time per     */
+/* lookup is printed                                */
+/****************************************************/
+
+#include "globals.h"
+#include "keyword.h"
+#include <ctype.h>
+#include <time.h>
+
+/* MAXRESERVED = the number of reserved words */
+#define MAXRESERVED 6
+
+/* the table and the search of the TINY scanner */
+static struct
+{
+	char *str;
+	TokenType tok;
+} reservedWords[MAXRESERVED] = {
+	{"if", IF},
+	{"else", ELSE},
+	{"while", WHILE},
+	{"return", RETURN},
+	{"int", INT},
+	{"void", VOID},
+};
+
+/* lookup an identifier to see if it is a reserved word */
+/* uses linear search */
+static TokenType reservedLookup(char *s)
+{
+	int i;
+	for (i = 0; i < MAXRESERVED; i++)
+		if (!strcmp(s, reservedWords[i].str))
+			return reservedWords[i].tok;
+	return ID;
+}
+
+/* the words of the program, each NUL-terminated as
+ * reservedLookup needs, with their lengths */
+static char **words;
+static int *lens;
+static int nwords;
+
+/* readWords collects the identifier-shaped words of
+ * file f */
+static void readWords(FILE *f)
+{
+	char buf[256];
+	int c, len = 0, cap = 0;
+	do
+	{
+		c = getc(f);
+		if (c != EOF && (isalpha(c) || (len > 0 && isalnum(c))))
+		{
+			if (len < (int)sizeof(buf) - 1)
+				buf[len++] = (char)c;
+			continue;
+		}
+		if (len == 0)
+			continue;
+		if (nwords == cap)
+		{
+			cap = cap == 0 ? 4096 : 2 * cap;
+			words = realloc(words, cap * sizeof(char *));
+			lens = realloc(lens, cap * sizeof(int));
+			if (words == NULL || lens == NULL)
+			{
+				fprintf(stderr, "Out of memory\n");
+				exit(1);
+			}
+		}
+		buf[len] = '\0';
+		words[nwords] = strdup(buf);
+		lens[nwords++] = len;
+		len = 0;
+	} while (c != EOF);
+}
+
+/* seconds returns the processor time used so far */
+static double seconds(void)
+{
+	return (double)clock() / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+	int rounds = argc > 2 ? atoi(argv[2]) : 20;
+	long found = 0, lookups;
+	double start, linear, hashed;
+	FILE *f;
+	int r, i;
+	if (argc < 2 || (f = fopen(argv[1], "r")) == NULL)
+	{
+		fprintf(stderr, "usage: %s <program> [rounds]\n", argv[0]);
+		exit(1);
+	}
+	readWords(f);
+	fclose(f);
+	lookups = (long)rounds * nwords;
+
+	start = seconds();
+	for (r = 0; r < rounds; r++)
+		for (i = 0; i < nwords; i++)
+			found += reservedLookup(words[i]) != ID;
+	linear = seconds() - start;
+
+	start = seconds();
+	for (r = 0; r < rounds; r++)
+		for (i = 0; i < nwords; i++)
+			found -= keywordLookup(words[i], lens[i]) != ID;
+	hashed = seconds() - start;
+
+	if (found != 0)
+	{
+		fprintf(stderr, "the lookups disagree\n");
+		exit(1);
+	}
+	printf("%d words, %ld lookups each\n", nwords, lookups);
+	printf("  %-36s %6.2f ns per word\n", "linear strcmp (reservedLookup)",
+		   linear * 1e9 / lookups);
+	printf("  %-36s %6.2f ns per word\n", "perfect hash (keywordLookup)",
+		   hashed * 1e9 / lookups);
+	return 0;
+}
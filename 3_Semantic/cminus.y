@@ -10,13 +10,26 @@
 #include "globals.h"
 #include "util.h"
 #include "scan.h"
+#include "tokens.h"
 #include "parse.h"
+#include "compile.h"
 
-#define YYSTYPE TreeNode *
-static char * savedName; /* for use in assignments */
-static int savedLineNo;  /* ditto */
-static TreeNode * savedTree; /* stores syntax tree for later return */
-static int yylex(void); // added 11/2/11 to ensure no conflict with lex
+/* a location is the span of source a symbol covers,
+ * so a node records where its first token starts
+ * rather than the line the scanner has reached by
+ * the time the rule is reduced
+ */
+#define YYLTYPE Span
+#define YYLLOC_DEFAULT(Cur, Rhs, N)                              \
+  do                                                             \
+    if (N)                                                       \
+    { (Cur).pos = YYRHSLOC(Rhs, 1).pos;                          \
+      (Cur).len = YYRHSLOC(Rhs, N).pos + YYRHSLOC(Rhs, N).len    \
+                  - (Cur).pos; }                                 \
+    else                                                         \
+    { (Cur).pos = YYRHSLOC(Rhs, 0).pos + YYRHSLOC(Rhs, 0).len;   \
+      (Cur).len = 0; }                                           \
+  while (0)
 
 %} 
 /* Define Section - Cleared */
@@ -42,21 +55,98 @@ static int yylex(void); // added 11/2/11 to ensure no conflict with lex
 
 %nonassoc ERROR /* ERROR  */
 
+%locations
+%define api.pure full
+%define api.push-pull both
+%code requires {
+struct compilation;
+
+/* a NodeList is a sibling chain under construction,
+ * with its last node kept at hand so that appending
+ * to it does not walk the whole chain
+ */
+typedef struct
+{
+  int head; /* NodeIds */
+  int tail;
+} NodeList;
+
+/* a TokenData is what a rule for a single keyword,
+ * operator, type or identifier passes up, in place
+ * of a node: where the token is and what it stands for
+ */
+typedef struct
+{
+  int pos;  /* its offset in the source */
+  int op;   /* a TokenType, for operators and keywords */
+  int name; /* an Atom, for identifiers */
+  int type; /* an ExpType, for type specifiers */
+} TokenData;
+}
+
+%union {
+  int node; /* a NodeId */
+  NodeList list;
+  TokenData tok;
+}
+
+%code {
+/* the parser is pure: all of its state is in the
+ * Compilation it is handed, and the syntax tree is
+ * returned in cc->tree
+ */
+static int yylex(YYSTYPE *lvalp, Span *llocp, Compilation *cc);
+static int yyerror(Span *llocp, Compilation *cc, char *message);
+
+/* N finds a node of the tree being built; the ids in
+ * the semantic values stay valid as the table grows
+ */
+#define N(id) nodeIn(&cc->nodes, id)
+
+/* appendNode adds the sibling chain t to the end of
+ * list. Only t itself is walked, so building a list
+ * of n nodes takes time linear in n.
+ */
+static void appendNode(NodeTable *tab, NodeList *list, NodeId t)
+{
+  if (t == NONODE)
+    return;
+  if (list->tail == NONODE)
+    list->head = t;
+  else
+    nodeIn(tab, list->tail)->sibling = t;
+  while (nodeIn(tab, t)->sibling != NONODE)
+    t = nodeIn(tab, t)->sibling;
+  list->tail = t;
+}
+}
+
+%type <list> declaration_list param_list local_declarations statement_list arg_list
+%type <node> declaration var_declaration func_declaration
+%type <node> params param compound_stmt statement expression_stmt
+%type <node> selection_stmt iteration_stmt return_stmt expression var
+%type <node> simple_expression additive_expression term
+%type <node> factor call args num
+%type <tok> type_specifier relop addop mulop id lcurly If While Return
+%parse-param { struct compilation *cc }
+%lex-param { struct compilation *cc }
+
 %% /* Grammar for TINY -> modifing to Grammar for C-Minus */
 program     : declaration_list // Done 1
-                 { savedTree = $1;} 
+                 { cc->tree = $1.head;} 
             ;
 declaration_list    : declaration_list declaration // Done 2
                             { 
-                              YYSTYPE t = $1;
-                              if (t != NULL){
-                                while (t->sibling != NULL) t = t->sibling;
-                                t -> sibling = $2;
-                                $$ = $1;
-                              }
-                              else {$$ = $2;}
-                            }
-                            | declaration { $$ = $1; }
+                              $$ = $1;
+                              appendNode(&cc->nodes, &$$, $2);
+                              if (cc->declared != NULL) cc->declared($2);
+                            }
+                            | declaration
+                            {
+                              $$.head = $$.tail = NONODE;
+                              appendNode(&cc->nodes, &$$, $1);
+                              if (cc->declared != NULL) cc->declared($1);
+                            }
                             ;
 declaration        : var_declaration
                             { // Done 3
@@ -69,132 +159,110 @@ declaration        : var_declaration
                             ;
 var_declaration  : type_specifier id SEMI // where is the lineno
                             { // Done 4
-                              $$ = newDclrNode(VarK);
-                              $$->lineno = $1->lineno; 
-                              $$->attr.name=$2->attr.name;
-                              $$->type = $1->type;
+                              $$ = newDclrNode(&cc->nodes, VarK);
+                              N($$)->pos = $1.pos; 
+                              N($$)->attr.name = $2.name;
+                              N($$)->type = $1.type;
                               /* Do I have to save the ID? */
                             }
                             | type_specifier id LBRACE num RBRACE SEMI
                             {
-                              $$ = newDclrNode(ArrK);
-                              $$->lineno = $1->lineno; 
+                              $$ = newDclrNode(&cc->nodes, ArrK);
+                              N($$)->pos = $1.pos; 
                               
-                              if($1->type == Integer) $$->type = IntArr;
-                              else $$->type = VoidArr;
-                              $$->attr.name=$2->attr.name;
-                              $$->child [0]=$4;
+                              if($1.type == Integer) N($$)->type = IntArr;
+                              else N($$)->type = VoidArr;
+                              N($$)->attr.name = $2.name;
+                              N($$)->child [0]=$4;
                             }
                             ;
 type_specifier    : INT  // Done 5
                             {
-                              $$ = newDclrNode(TypeK);
-                              $$->lineno = lineno;
-                              $$->type = Integer;
+                              $$.pos = @1.pos;
+                              $$.type = Integer;
                             }
                             | VOID
                             {
-                              $$ = newDclrNode(TypeK);
-                              $$->lineno = lineno;
-                              $$->type = Void;
+                              $$.pos = @1.pos;
+                              $$.type = Void;
                             }
                             ;
 func_declaration : type_specifier id LPAREN params RPAREN compound_stmt  // Done 6
                             {
-                              $$ = newDclrNode(FuncK);
+                              $$ = newDclrNode(&cc->nodes, FuncK);
                               
-                              $$->child[0] = $6;
-                              $$->child[1] = $4;
-                              $$->lineno = $1->lineno; 
-                              $$->attr.name = $2->attr.name;
-                              $$->attr.val = $4->attr.val;
-                              $$->type = $1->type;
+                              N($$)->child[0] = $6;
+                              N($$)->child[1] = $4;
+                              N($$)->pos = $1.pos; 
+                              N($$)->attr.name = $2.name;
+                              N($$)->type = $1.type;
                             }
                             ;
 params                : param_list // Done 7
                             {
-                              $$ = $1;
+                              $$ = $1.head;
                             }
                             | VOID // Is it Right?
                             {
-                              $$ = newParamNode(NullK);
-                              $$->lineno = lineno; 
-                              $$->type = Null;
-                              $$->attr.val =0;
+                              $$ = newParamNode(&cc->nodes, NullK);
+                              N($$)->pos = @1.pos; 
+                              N($$)->type = Null;
                             }
                             ;
 param_list            : param_list COMMA param // Done 8
                             { 
-                              YYSTYPE t = $1;
-                              if (t != NULL){
-                                while (t->sibling != NULL) t = t->sibling;
-                                t -> sibling = $3;  
-                                int cnt = $1->attr.val;
-                                $$ = $1;
-                                $$->attr.val = cnt +1;
-                              }
-                              else {$$ = $3; $$->attr.val=1;}
+                              $$ = $1;
+                              appendNode(&cc->nodes, &$$, $3);
                             }
                             | param
                             {
-                              int cnt = $1->attr.val;
-                              $$ = $1;
-                              $$->attr.val = cnt +1;
+                              $$.head = $$.tail = NONODE;
+                              appendNode(&cc->nodes, &$$, $1);
                             }
                             ;
 param                : type_specifier id // Done 9
                             {
-                              $$ = newParamNode(NArrK);
-                              $$->lineno = $1->lineno; 
-                              $$->attr.name = $2->attr.name;
-                              $$->type = $1 ->type;
+                              $$ = newParamNode(&cc->nodes, NArrK);
+                              N($$)->pos = $1.pos; 
+                              N($$)->attr.name = $2.name;
+                              N($$)->type = $1.type;
                             }
                             | type_specifier id LBRACE RBRACE
                             {
-                              $$ = newParamNode(ArrPK);
-                              $$->lineno = $1->lineno; 
-                              $$->attr.name = $2->attr.name;
+                              $$ = newParamNode(&cc->nodes, ArrPK);
+                              N($$)->pos = $1.pos; 
+                              N($$)->attr.name = $2.name;
                               
-                              if($1->type == Void) $$->type = VoidArr;
-                              else $$->type = IntArr;
+                              if($1.type == Void) N($$)->type = VoidArr;
+                              else N($$)->type = IntArr;
                             }
                             ;
 compound_stmt : lcurly local_declarations statement_list RCURLY // Done 10
                             {
-                              $$ = newStmtNode(CompK);
-                              $$ -> child[0] = $2;
-                              $$ -> child[1] = $3;
-                              $$->lineno = $1-> lineno;
+                              $$ = newStmtNode(&cc->nodes, CompK);
+                              N($$)->child[0] = $2.head;
+                              N($$)->child[1] = $3.head;
+                              N($$)->pos = $1.pos;
                             }
                             ;
 local_declarations : local_declarations var_declaration // Done 11
                             { 
-                              YYSTYPE t = $1;
-                              if (t != NULL){
-                                while (t->sibling != NULL) t = t->sibling;
-                                t -> sibling = $2;
-                                $$ = $1;
-                              }
-                              else {$$ = $2;}
+                              $$ = $1;
+                              appendNode(&cc->nodes, &$$, $2);
                             }
                             | 
                             {
-                              $$ = NULL;
+                              $$.head = $$.tail = NONODE;
                             }
                             ;
 statement_list    : statement_list statement // Done 12
                             { 
-                              YYSTYPE t = $1;
-                              if (t != NULL){
-                                while (t->sibling != NULL) t = t->sibling;
-                                t -> sibling = $2;
-                                $$ = $1;
-                              }
-                              else {$$ = $2;}
+                              $$ = $1;
+                              appendNode(&cc->nodes, &$$, $2);
                             }
                             |
                             {
-                              $$ = NULL;
+                              $$.head = $$.tail = NONODE;
                             }
                             ;
 statement          : expression_stmt // Done 13
@@ -228,55 +296,55 @@ expression_stmt : expression SEMI // Done 14
                              }
                              | SEMI 
                              {
-                              $$ = NULL;
+                              $$ = NONODE;
                              }
                              ;
 selection_stmt   : If LPAREN expression RPAREN statement // Done 15
                             {
-                              $$ = newStmtNode(IfK);
-                              $$ -> child[0] = $3;
-                              $$ -> child[1] = $5;
-                              $$ -> lineno = $1->lineno;
+                              $$ = newStmtNode(&cc->nodes, IfK);
+                              N($$)->child[0] = $3;
+                              N($$)->child[1] = $5;
+                              N($$)->pos = $1.pos;
                             }
                             |
                             If LPAREN expression RPAREN statement ELSE statement
                             {
-                              $$ = newStmtNode(ElseK);
-                              $$ -> child[0] = $3;
-                              $$ -> child[1] = $5;
-                              $$ -> child[2] = $7;
-                              $$ -> lineno = $1->lineno;
+                              $$ = newStmtNode(&cc->nodes, ElseK);
+                              N($$)->child[0] = $3;
+                              N($$)->child[1] = $5;
+                              N($$)->child[2] = $7;
+                              N($$)->pos = $1.pos;
                             }
                             ;
 iteration_stmt    : While LPAREN expression RPAREN statement // Done 16
                             {
-                              $$ = newStmtNode(WhileK);
-                              $$->child[0] = $3;
-                              $$->child[1] = $5;
-                              $$ -> lineno = $1->lineno;
+                              $$ = newStmtNode(&cc->nodes, WhileK);
+                              N($$)->child[0] = $3;
+                              N($$)->child[1] = $5;
+                              N($$)->pos = $1.pos;
                             }
                             ;
 return_stmt        : Return SEMI // Done 17
                             {
-                              $$ = newStmtNode(NonReturnK);
-                              $$ -> lineno = $1->lineno;
-                              $$ -> type = Void;
+                              $$ = newStmtNode(&cc->nodes, NonReturnK);
+                              N($$)->pos = $1.pos;
+                              N($$)->type = Void;
                             }
                             |
                             Return expression SEMI
                             {
-                              $$ = newStmtNode(ReturnK);
-                              $$ -> child[0] = $2;
-                              $$ -> lineno = $1->lineno;
-                              $$->type = Integer;
+                              $$ = newStmtNode(&cc->nodes, ReturnK);
+                              N($$)->child[0] = $2;
+                              N($$)->pos = $1.pos;
+                              N($$)->type = Integer;
                             }
                             ;
 expression         : var ASSIGN expression // Done 18
                             {
-                              $$ = newStmtNode(AssignK);
-                              $$-> child[0] = $1;
-                              $$-> child[1] = $3;
-                              $$ -> lineno = $1->lineno;
+                              $$ = newStmtNode(&cc->nodes, AssignK);
+                              N($$)->child[0] = $1;
+                              N($$)->child[1] = $3;
+                              N($$)->pos = N($1)->pos;
                             }
                             |
                             simple_expression
@@ -286,25 +354,25 @@ expression         : var ASSIGN expression // Done 18
                             ;
 var                      : id // Done 19
                             {
-                              $$ = newExpNode(IdK);
-                              $$ -> lineno = $1->lineno;
-                              $$-> attr.name = $1->attr.name;
+                              $$ = newExpNode(&cc->nodes, IdK);
+                              N($$)->pos = $1.pos;
+                              N($$)->attr.name = $1.name;
                             }
                             | id LBRACE expression RBRACE
                             {
-                              $$ = newExpNode(ArrEK);
-                              $$->child[0] = $3;
-                              $$ -> lineno = $1->lineno;
-                              $$-> attr.name = $1->attr.name;
+                              $$ = newExpNode(&cc->nodes, ArrEK);
+                              N($$)->child[0] = $3;
+                              N($$)->pos = $1.pos;
+                              N($$)->attr.name = $1.name;
                             }
                             ;
 simple_expression : additive_expression relop additive_expression //  Done 20
                             {
-                              $$ = newExpNode(OpK);
-                              $$-> child[0] = $1;
-                              $$-> child[1] = $3;
-                              $$ -> lineno = $1->lineno;
-                              $$->attr.op = $2->attr.op;
+                              $$ = newExpNode(&cc->nodes, OpK);
+                              N($$)->child[0] = $1;
+                              N($$)->child[1] = $3;
+                              N($$)->pos = N($1)->pos;
+                              N($$)->attr.op = $2.op;
                             }
                             |
                             additive_expression
@@ -314,53 +382,47 @@ simple_expression : additive_expression relop additive_expression //  Done 20
                             ;
 relop                  : LE // Done 21
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = LE;
+                              $$.pos = @1.pos;
+                              $$.op = LE;
                             }
                             | 
                             LT
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = LT;
+                              $$.pos = @1.pos;
+                              $$.op = LT;
                             }
                             | 
                             GT
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = GT;
+                              $$.pos = @1.pos;
+                              $$.op = GT;
                             }
                             | 
                             GE
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = GE;
+                              $$.pos = @1.pos;
+                              $$.op = GE;
                             }
                             | 
                             EQ
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = EQ;
+                              $$.pos = @1.pos;
+                              $$.op = EQ;
                             }
                             | 
                             NE
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = NE;
+                              $$.pos = @1.pos;
+                              $$.op = NE;
                             }
                             ;
 additive_expression : additive_expression addop term //  Done 22
                             {
-                              $$ = newExpNode(OpK);
-                              $$-> child[0] = $1;
-                              $$-> child[1] = $3;
-                              $$->lineno = $1->lineno;
-                              $$->attr.op = $2->attr.op;
+                              $$ = newExpNode(&cc->nodes, OpK);
+                              N($$)->child[0] = $1;
+                              N($$)->child[1] = $3;
+                              N($$)->pos = N($1)->pos;
+                              N($$)->attr.op = $2.op;
                             }
                             |
                             term
@@ -370,25 +432,23 @@ additive_expression : additive_expression addop term //  Done 22
                             ;
 addop                  : PLUS // Done 23
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = PLUS;
+                              $$.pos = @1.pos;
+                              $$.op = PLUS;
                             }
                             | 
                             MINUS
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = MINUS;
+                              $$.pos = @1.pos;
+                              $$.op = MINUS;
                             }
                             ;
 term                     : term mulop factor //  Done 24
                             {
-                              $$ = newExpNode(OpK);
-                              $$-> child[0] = $1;
-                              $$-> child[1] = $3;
-                              $$->lineno = $1->lineno;
-                              $$->attr.op = $2->attr.op;
+                              $$ = newExpNode(&cc->nodes, OpK);
+                              N($$)->child[0] = $1;
+                              N($$)->child[1] = $3;
+                              N($$)->pos = N($1)->pos;
+                              N($$)->attr.op = $2.op;
                             }
                             |
                             factor
@@ -398,16 +458,14 @@ term                     : term mulop factor //  Done 24
                             ;
 mulop                  : TIMES // Done 25
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = TIMES;
+                              $$.pos = @1.pos;
+                              $$.op = TIMES;
                             }
                             | 
                             OVER
                             {
-                              $$ = newExpNode(OpK);
-                              $$->lineno = lineno;
-                              $$->attr.op = OVER;
+                              $$.pos = @1.pos;
+                              $$.op = OVER;
                             }
                             ;
 factor                   : LPAREN expression RPAREN//  Done 26
@@ -427,109 +485,147 @@ factor                   : LPAREN expression RPAREN//  Done 26
                             |
                             num
                             {
-                              $$ = newExpNode(ConstK);
-                              $$->lineno = $1->lineno;
-                              $$->attr.val = $1->attr.val;
-                              $$->type = $1->type;
+                              $$ = $1;
                             }
                             ;
 call                     : id LPAREN args RPAREN // Done 27
                             {
-                              $$=newExpNode(CallK);
-                              $$->child[0] = $3;
-                              $$->lineno = $1->lineno;
-                              $$->attr.name = $1->attr.name;
+                              $$=newExpNode(&cc->nodes, CallK);
+                              N($$)->child[0] = $3;
+                              N($$)->pos = $1.pos;
+                              N($$)->attr.name = $1.name;
                             }
                             ;
 args                    : arg_list // Done 28
                              {
-                              $$=$1;
+                              $$=$1.head;
                              }
                              |
                              {
-                              $$= NULL;
+                              $$= NONODE;
                              }
                              ;
 arg_list               : arg_list COMMA expression // Done 29
-                            { YYSTYPE t = $1;
-                              if (t != NULL) 
-                              { 
-                                while (t->sibling != NULL)
-                                    t = t->sibling;
-                                t->sibling = $3;
-                                $$ = $1; 
-                              }
-                              else {$$ = $3;} 
+                            { 
+                              $$ = $1;
+                              appendNode(&cc->nodes, &$$, $3);
                             }
                             |
                             expression
                             {
-                              $$ = $1;
+                              $$.head = $$.tail = NONODE;
+                              appendNode(&cc->nodes, &$$, $1);
                             }
                             ;
 id                      : ID
                           {
-                            $$ = newExpNode(IdK);
-                            $$->lineno = lineno;
-                            $$->attr.name = copyString(tokenString);
+                            $$.pos = @1.pos;
+                            $$.name = cc->tokenAtom;
                           }
                           ;
 num                : NUM
                           {
-                            $$ = newExpNode(ConstK);
-                            $$->lineno = lineno;
-                            $$->attr.val = atoi(tokenString);
-                            $$-> type = Integer;
+                            $$ = newExpNode(&cc->nodes, ConstK);
+                            N($$)->pos = @1.pos;
+                            N($$)->attr.val = cc->tokenVal;
+                            N($$)->type = Integer;
                           } 
                           ;
 lcurly            : LCURLY
                           {
-                            $$ = newExpNode(OpK);
-                            $$->lineno = lineno;
-                            $$->attr.op = LCURLY;
+                            $$.pos = @1.pos;
+                            $$.op = LCURLY;
                           } 
                           ;
 If                     : IF
                           {
-                            $$ = newStmtNode(IfK);
-                            $$->lineno = lineno;
-                            $$->attr.op = IF;
+                            $$.pos = @1.pos;
+                            $$.op = IF;
                           } 
                           ;
 While             : WHILE
                           {
-                            $$ = newStmtNode(WhileK);
-                            $$->lineno = lineno;
-                            $$->attr.op = WHILE;
+                            $$.pos = @1.pos;
+                            $$.op = WHILE;
                           } 
                           ;
 Return           : RETURN
                           {
-                            $$ = newStmtNode(ReturnK);
-                            $$->lineno = lineno;
-                            $$->attr.op = RETURN;
+                            $$.pos = @1.pos;
+                            $$.op = RETURN;
                           } 
                           ;
 %%
 
-int yyerror(char * message)
-{ fprintf(listing,"Syntax error at line %d: %s\n",lineno,message);
-  fprintf(listing,"Current token: ");
-  printToken(yychar,tokenString);
-  Error = TRUE;
-  savedTree=NULL;
+static int yyerror(Span * llocp, Compilation * cc, char * message)
+{ (void)llocp;
+  if (cc->listing != NULL)
+  { fprintf(cc->listing,"Syntax error at line %d: %s\n",cc->lineno,message);
+    fprintf(cc->listing,"Current token: ");
+    fprintToken(cc->listing,cc->token,cc->source->text+cc->tokenSpan.pos,cc->tokenSpan.len);
+  }
+  cc->error = TRUE;
+  cc->tree=NONODE;
   return 0;
 }
 
-/* yylex calls getToken to make Yacc/Bison output
- * compatible with ealier versions of the TINY scanner
+/* yylex hands the parser the next token of cc, from
+ * its pre-scanned stream or from the scanner; the
+ * token's span becomes its location
  */
-static int yylex(void)
-{ return getToken(); }
+static int yylex(YYSTYPE * lvalp, Span * llocp, Compilation * cc)
+{ int token = cc->stream != NULL ? streamToken(cc->stream, cc) : nextToken(cc);
+  (void)lvalp;
+  *llocp = cc->tokenSpan;
+  return token; }
+
+NodeId parseCompilation(Compilation * cc)
+{ cc->tree = NONODE;
+  cc->error = FALSE;
+  if (DescentParse) descentParse(cc);
+  else yyparse(cc);
+  return cc->tree;
+}
+
+void pushStart(Compilation * cc)
+{ cc->tree = NONODE;
+  cc->error = FALSE;
+  cc->parser = yypstate_new();
+  if (cc->parser == NULL)
+  { fprintf(cc->listing,"Out of memory starting the parser\n");
+    exit(1);
+  }
+}
 
-TreeNode * parse(void)
-{ 
-  yyparse();
-  return savedTree;
+int pushToken(Compilation * cc, TokenType token)
+{ YYSTYPE val;
+  Span loc = cc->tokenSpan;
+  memset(&val,0,sizeof(val));
+  if (yypush_parse((yypstate *)cc->parser,token,&val,&loc,cc) == YYPUSH_MORE)
+    return TRUE;
+  yypstate_delete((yypstate *)cc->parser);
+  cc->parser = NULL;
+  return FALSE;
 }
 
+/* parse and parseTokens parse the main compilation,
+ * reporting syntax errors through Error
+ */
+NodeId parse(void)
+{ Compilation * cc = mainCompilation();
+  cc->stream = NULL;
+  parseCompilation(cc);
+  useCompilation(cc);
+  if (cc->error) Error = TRUE;
+  return cc->tree;
+}
+
+NodeId parseTokens(TokenStream * ts)
+{ Compilation * cc = mainCompilation();
+  cc->stream = ts;
+  parseCompilation(cc);
+  useCompilation(cc);
+  cc->stream = NULL;
+  if (cc->error) Error = TRUE;
+  return cc->tree;
+}
@@ -0,0 +1,183 @@
+/****************************************************/
+/* File: compile.c                                  */
+/* Per-compilation front end state for the C-Minus  */
+/* compiler                                         */
+/* The scanner and the parser work on a Compilation */
+/* and touch no globals of their own; getToken and  */
+/* parse keep the old interface on top of a single  */
+/* main compilation.                                */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "intern.h"
+#include "compile.h"
+#include "parse.h"
+#include "trace.h"
+#include <pthread.h>
+
+/* copies of the current token of the main
+ * compilation (see scan.h)
+ */
+Span tokenSpan;
+Atom tokenAtom = NOATOM;
+int tokenVal = 0;
+
+Compilation *mainCompilation(void)
+{
+  static Compilation cc;
+  static int ready = FALSE;
+  if (!ready)
+  {
+    ready = TRUE;
+    cc.file = source;
+    cc.source = curSource;
+    cc.listing = listing;
+    cc.trace = TraceScan;
+    cc.tokenAtom = NOATOM;
+    initScanner(&cc);
+  }
+  return &cc;
+}
+
+TokenType getToken(void)
+{
+  Compilation *cc = mainCompilation();
+  TokenType currentToken = nextToken(cc);
+  lineno = cc->lineno;
+  tokenSpan = cc->tokenSpan;
+  tokenAtom = cc->tokenAtom;
+  tokenVal = cc->tokenVal;
+  return currentToken;
+}
+
+TokenType nextToken(Compilation *cc)
+{
+  TokenType currentToken = scanToken(cc);
+  cc->token = currentToken;
+  if (cc->trace && TraceBinary)
+    traceToken(currentToken, cc->tokenSpan, cc->lineno);
+  else if (cc->trace)
+  {
+    fprintf(cc->listing, "\t%d: ", cc->lineno);
+    fprintToken(cc->listing, currentToken, cc->source->text + cc->tokenSpan.pos,
+                cc->tokenSpan.len);
+  }
+  return currentToken;
+}
+
+int openCompilation(Compilation *cc, char *name, FILE *listing)
+{
+  memset(cc, 0, sizeof(Compilation));
+  cc->name = name;
+  cc->listing = listing;
+  cc->tokenAtom = NOATOM;
+  cc->file = fopen(name, "r");
+  if (cc->file == NULL)
+  {
+    fprintf(listing, "File %s not found\n", name);
+    return FALSE;
+  }
+  cc->source = malloc(sizeof(Source));
+  if (cc->source == NULL || !openSource(cc->source, cc->file))
+  {
+    fprintf(listing, "Unable to read %s\n", name);
+    free(cc->source);
+    cc->source = NULL;
+    fclose(cc->file);
+    cc->file = NULL;
+    return FALSE;
+  }
+  initScanner(cc);
+  return TRUE;
+}
+
+void closeCompilation(Compilation *cc)
+{
+  if (cc->source != NULL)
+  {
+    freeScanner(cc);
+    if (curSource == cc->source)
+      curSource = NULL;
+    closeSource(cc->source);
+    free(cc->source);
+    cc->source = NULL;
+  }
+  if (cc->file != NULL)
+    fclose(cc->file);
+  cc->file = NULL;
+}
+
+void freeTree(Compilation *cc)
+{
+  freeNodes(&cc->nodes);
+  cc->tree = NONODE;
+}
+
+void useCompilation(Compilation *cc)
+{
+  curSource = cc->source;
+  curTree = &cc->nodes;
+}
+
+/* a Job is one file for compileFiles to parse */
+typedef struct
+{
+  Compilation *cc;
+  char *name;
+  FILE *listing;
+  int failed;
+} Job;
+
+/* compileJob is the thread body of compileFiles */
+static void *compileJob(void *arg)
+{
+  Job *job = (Job *)arg;
+  job->failed = TRUE;
+  if (openCompilation(job->cc, job->name, job->listing))
+  {
+    parseCompilation(job->cc);
+    job->failed = job->cc->error;
+  }
+  return NULL;
+}
+
+int compileFiles(Compilation *cs, char **names, int n, FILE *listing)
+{
+  Job *jobs = malloc(n * sizeof(Job));
+  pthread_t *threads = malloc(n * sizeof(pthread_t));
+  int *started = calloc(n, sizeof(int));
+  int k, failures = 0;
+  if (jobs == NULL || threads == NULL || started == NULL)
+  {
+    fprintf(listing, "Out of memory starting %d compilations\n", n);
+    exit(1);
+  }
+  for (k = 0; k < n; k++)
+  {
+    jobs[k].cc = &cs[k];
+    jobs[k].name = names[k];
+    jobs[k].listing = listing;
+  }
+  /* the intern pool is the only state the threads
+   * share, so it is locked while they run
+   */
+  if (ScanReentrant && n > 1)
+  {
+    internShared(TRUE);
+    for (k = 0; k < n; k++)
+      started[k] = pthread_create(&threads[k], NULL, compileJob, &jobs[k]) == 0;
+  }
+  for (k = 0; k < n; k++)
+    if (started[k])
+      pthread_join(threads[k], NULL);
+    else
+      compileJob(&jobs[k]);
+  internShared(FALSE);
+  for (k = 0; k < n; k++)
+    failures += jobs[k].failed;
+  free(jobs);
+  free(threads);
+  free(started);
+  return failures;
+}
@@ -0,0 +1,83 @@
+/****************************************************/
+/* File: compile.h                                  */
+/* Per-compilation front end state for the C-Minus  */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _COMPILE_H_
+#define _COMPILE_H_
+
+#include "scan.h"
+#include "source.h"
+#include "tokens.h"
+
+/* A Compilation holds everything the scanner and the
+ * parser know about one source program, so that any
+ * number of programs can be scanned and parsed at
+ * once on different threads
+ */
+typedef struct compilation
+{
+  char *name;           /* source file name */
+  FILE *file;           /* the open source file */
+  Source *source;       /* its text and line index */
+  FILE *listing;        /* where messages are written, if anywhere */
+  int trace;            /* echo each token to listing */
+  void *scanner;        /* state private to the scanner */
+  TokenStream *stream;  /* pre-scanned tokens, or NULL */
+  int lineno;           /* line of the current token */
+  TokenType token;      /* the current token */
+  Span tokenSpan;       /* its place in the source, which
+                         * holds its lexeme */
+  Atom tokenAtom;       /* its name, if it is an ID */
+  int tokenVal;         /* its value, if it is a NUM */
+  NodeId tree;          /* the syntax tree, once parsed */
+  NodeTable nodes;      /* the nodes of tree */
+  int error;            /* TRUE after a syntax error */
+  void *parser;         /* state of a push parse */
+  void (*declared)(NodeId); /* told of each top-level declaration
+                             * as soon as it is parsed, if set */
+} Compilation;
+
+/* Function mainCompilation returns the compilation
+ * of the program in the global source file, read
+ * into curSource and listed on the global listing
+ */
+Compilation *mainCompilation(void);
+
+/* Function openCompilation opens file name, loads
+ * it and readies the scanner for it. Messages go to
+ * listing. Returns FALSE if the file cannot be read.
+ */
+int openCompilation(Compilation *cc, char *name, FILE *listing);
+
+/* Procedure closeCompilation releases everything cc
+ * holds except its syntax tree
+ */
+void closeCompilation(Compilation *cc);
+
+/* Procedure freeTree releases the syntax tree of cc
+ * and every other node parsing it allocated
+ */
+void freeTree(Compilation *cc);
+
+/* Procedure useCompilation makes the source and the
+ * syntax tree of cc current, which the analyzer needs
+ * in order to reach the nodes of the tree and turn
+ * their positions into line numbers
+ */
+void useCompilation(Compilation *cc);
+
+/* Function nextToken returns the next token of cc,
+ * echoing it to the listing if cc->trace is set
+ */
+TokenType nextToken(Compilation *cc);
+
+/* Function compileFiles opens and parses the n files
+ * named in names into cs[0..n-1], one thread per file
+ * when the scanner allows it. Returns the number of
+ * files that could not be read or did not parse.
+ */
+int compileFiles(Compilation *cs, char **names, int n, FILE *listing);
+
+#endif
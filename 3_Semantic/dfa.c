@@ -0,0 +1,195 @@
+/****************************************************/
+/* File: dfa.c                                      */
+/* Table-driven token recognizer for the C-Minus    */
+/* compiler                                         */
+/* Every byte is mapped to a character class by one */
+/* table lookup, and the class selects the state to */
+/* run next. With GCC the selection is a computed   */
+/* goto through a table of label addresses; other   */
+/* compilers get an equivalent switch.              */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include "keyword.h"
+#include "dfa.h"
+#include <limits.h>
+
+/* the character classes, as an X-macro so the class
+ * names, the dispatch table and the fallback switch
+ * are generated from one list
+ */
+#define CLASSES(X) \
+  X(Other)         \
+  X(Blank)         \
+  X(Newline)       \
+  X(Digit)         \
+  X(Letter)        \
+  X(Single)        \
+  X(Less)          \
+  X(Greater)       \
+  X(Equal)         \
+  X(Bang)          \
+  X(Slash)         \
+  X(Nul)
+
+typedef enum
+{
+#define CLASS_ENUM(c) c##C,
+  CLASSES(CLASS_ENUM)
+#undef CLASS_ENUM
+} CharClass;
+
+/* charClass maps every byte to its class; bytes not
+ * listed are OtherC and scan as ERROR, as with the
+ * catch-all rule of cminus.l
+ */
+static const unsigned char charClass[256] = {
+    ['\0'] = NulC, [' '] = BlankC, ['\t'] = BlankC, ['\n'] = NewlineC,
+    ['0'] = DigitC, ['1'] = DigitC, ['2'] = DigitC, ['3'] = DigitC,
+    ['4'] = DigitC, ['5'] = DigitC, ['6'] = DigitC, ['7'] = DigitC,
+    ['8'] = DigitC, ['9'] = DigitC,
+    ['a'] = LetterC, ['b'] = LetterC, ['c'] = LetterC, ['d'] = LetterC,
+    ['e'] = LetterC, ['f'] = LetterC, ['g'] = LetterC, ['h'] = LetterC,
+    ['i'] = LetterC, ['j'] = LetterC, ['k'] = LetterC, ['l'] = LetterC,
+    ['m'] = LetterC, ['n'] = LetterC, ['o'] = LetterC, ['p'] = LetterC,
+    ['q'] = LetterC, ['r'] = LetterC, ['s'] = LetterC, ['t'] = LetterC,
+    ['u'] = LetterC, ['v'] = LetterC, ['w'] = LetterC, ['x'] = LetterC,
+    ['y'] = LetterC, ['z'] = LetterC,
+    ['A'] = LetterC, ['B'] = LetterC, ['C'] = LetterC, ['D'] = LetterC,
+    ['E'] = LetterC, ['F'] = LetterC, ['G'] = LetterC, ['H'] = LetterC,
+    ['I'] = LetterC, ['J'] = LetterC, ['K'] = LetterC, ['L'] = LetterC,
+    ['M'] = LetterC, ['N'] = LetterC, ['O'] = LetterC, ['P'] = LetterC,
+    ['Q'] = LetterC, ['R'] = LetterC, ['S'] = LetterC, ['T'] = LetterC,
+    ['U'] = LetterC, ['V'] = LetterC, ['W'] = LetterC, ['X'] = LetterC,
+    ['Y'] = LetterC, ['Z'] = LetterC,
+    ['+'] = SingleC, ['-'] = SingleC, ['*'] = SingleC, [';'] = SingleC,
+    [','] = SingleC, ['('] = SingleC, [')'] = SingleC, ['{'] = SingleC,
+    ['}'] = SingleC, ['['] = SingleC, [']'] = SingleC,
+    ['<'] = LessC, ['>'] = GreaterC, ['='] = EqualC, ['!'] = BangC,
+    ['/'] = SlashC};
+
+/* singleToken gives the token of each SingleC byte */
+static const TokenType singleToken[128] = {
+    ['+'] = PLUS, ['-'] = MINUS, ['*'] = TIMES, [';'] = SEMI,
+    [','] = COMMA, ['('] = LPAREN, [')'] = RPAREN, ['{'] = LCURLY,
+    ['}'] = RCURLY, ['['] = LBRACE, [']'] = RBRACE};
+
+#define CLASS(c) charClass[(unsigned char)(c)]
+
+#ifdef __GNUC__
+#define DISPATCH(c) goto *dispatch[CLASS(c)]
+#else
+#define CLASS_CASE(c) \
+  case c##C:          \
+    goto in##c;
+#define DISPATCH(c)       \
+  switch (CLASS(c))       \
+  {                       \
+    CLASSES(CLASS_CASE)   \
+  }
+#endif
+
+/* the source buffer ends in a NUL (see source.h), so
+ * the states below look ahead without bounds checks;
+ * a NUL before the end of the text is just an illegal
+ * character
+ */
+TokenType dfaToken(const Source *src, int pos, int *nl, Span *span, int *val)
+{
+#ifdef __GNUC__
+#define CLASS_LABEL(c) &&in##c,
+  static const void *const dispatch[] = {CLASSES(CLASS_LABEL)};
+#undef CLASS_LABEL
+#endif
+  const char *s = src->text + pos;
+  const char *start;
+  TokenType t;
+  unsigned v;
+
+next:
+  start = s;
+  DISPATCH(*s);
+
+inBlank:
+  do
+    s++;
+  while (CLASS(*s) == BlankC);
+  goto next;
+
+inNewline:
+  if (nl != NULL)
+    (*nl)++;
+  s++;
+  goto next;
+
+inSlash:
+  if (s[1] != '*')
+  {
+    s++;
+    t = OVER;
+    goto done;
+  }
+  s = skipComment(s + 2, src->text + src->len, nl);
+  goto next;
+
+inDigit:
+  v = 0;
+  t = NUM;
+  do
+  {
+    unsigned d = *s++ - '0';
+    if (v > (INT_MAX - d) / 10)
+      t = ERROR; /* out of range: still match every digit */
+    v = v * 10 + d;
+  } while (CLASS(*s) == DigitC);
+  *val = t == NUM ? (int)v : 0;
+  goto done;
+
+inLetter:
+  do
+    s++;
+  while (CLASS(*s) == LetterC || CLASS(*s) == DigitC);
+  t = keywordLookup(start, s - start);
+  goto done;
+
+inSingle:
+  t = singleToken[(unsigned char)*s++];
+  goto done;
+
+inLess:
+  t = s[1] == '=' ? LE : LT;
+  s += t == LE ? 2 : 1;
+  goto done;
+
+inGreater:
+  t = s[1] == '=' ? GE : GT;
+  s += t == GE ? 2 : 1;
+  goto done;
+
+inEqual:
+  t = s[1] == '=' ? EQ : ASSIGN;
+  s += t == EQ ? 2 : 1;
+  goto done;
+
+inBang:
+  t = s[1] == '=' ? NE : ERROR;
+  s += t == NE ? 2 : 1;
+  goto done;
+
+inNul:
+  if (s - src->text >= src->len)
+  {
+    t = ENDFILE;
+    goto done;
+  }
+  /* fall through */
+inOther:
+  s++;
+  t = ERROR;
+
+done:
+  span->pos = start - src->text;
+  span->len = s - start;
+  return t;
+}
@@ -0,0 +1,22 @@
+/****************************************************/
+/* File: dfa.h                                      */
+/* Table-driven token recognizer for the C-Minus    */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _DFA_H_
+#define _DFA_H_
+
+/* Function dfaToken recognizes the first token at or
+ * after offset pos in src, skipping blanks and
+ * comments, and returns its type. The token's place
+ * is stored in *span and the value of a NUM in *val;
+ * a number too large for an int is an ERROR.
+ * Unless nl is NULL, the newlines skipped are added
+ * to *nl. It follows the rules of cminus.l and only
+ * reads the source text, so any number of threads may
+ * call it at once.
+ */
+TokenType dfaToken(const Source *src, int pos, int *nl, Span *span, int *val);
+
+#endif
@@ -0,0 +1,57 @@
+/****************************************************/
+/* File: dscan.c                                    */
+/* The table-driven scanner for the C-Minus         */
+/* compiler: scanToken over the whole-file buffer,  */
+/* built on dfaToken in place of flex               */
+/****************************************************/
+
+#include "globals.h"
+#include "scan.h"
+#include "source.h"
+#include "intern.h"
+#include "dfa.h"
+#include "compile.h"
+
+const int ScanReentrant = TRUE;
+
+/* A DScan is the scanner state of one compilation.
+ * pos is the offset just past the current token.
+ */
+typedef struct
+{
+  int pos;
+} DScan;
+
+void initScanner(Compilation *cc)
+{
+  DScan *ds = calloc(1, sizeof(DScan));
+  if (ds == NULL)
+  {
+    fprintf(cc->listing, "Out of memory starting the scanner\n");
+    exit(1);
+  }
+  cc->scanner = ds;
+  cc->lineno = 1;
+}
+
+TokenType scanToken(Compilation *cc)
+{
+  DScan *ds = (DScan *)cc->scanner;
+  Source *src = cc->source;
+  TokenType currentToken;
+  int val = 0;
+  currentToken = dfaToken(src, ds->pos, NULL, &cc->tokenSpan, &val);
+  cc->lineno += markLines(src, ds->pos, cc->tokenSpan.pos - ds->pos);
+  ds->pos = cc->tokenSpan.pos + cc->tokenSpan.len;
+  if (currentToken == ID)
+    cc->tokenAtom = internName(src->text + cc->tokenSpan.pos, cc->tokenSpan.len);
+  else if (currentToken == NUM)
+    cc->tokenVal = val;
+  return currentToken;
+}
+
+void freeScanner(Compilation *cc)
+{
+  free(cc->scanner);
+  cc->scanner = NULL;
+}
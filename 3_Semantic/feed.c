@@ -0,0 +1,127 @@
+/****************************************************/
+/* File: feed.c                                     */
+/* Streaming front end for the C-Minus compiler     */
+/* The source is read a block at a time, as much as */
+/* the pipe holds, instead of to the end before any */
+/* scanning starts. The tokens of each block go to  */
+/* the yacc parser in push mode, which hands every  */
+/* finished top-level declaration on at once, so    */
+/* reading, parsing and analysis overlap.           */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include "intern.h"
+#include "dfa.h"
+#include "tokens.h"
+#include "parse.h"
+#include "compile.h"
+#include "feed.h"
+#include <unistd.h>
+#include <errno.h>
+
+/* FEEDBLOCK is the most read at a time */
+#define FEEDBLOCK 65536
+
+/* readBlock appends what is waiting on fd to src,
+ * up to FEEDBLOCK bytes, waiting for some if there
+ * is none. Returns the number of bytes read, 0 at end
+ * of file, or -1 if reading failed, which it reports.
+ */
+static int readBlock(Source *src, int fd, int *cap)
+{
+  ssize_t n;
+  if (src->len + FEEDBLOCK + 2 > *cap)
+  {
+    int grown = *cap;
+    char *text;
+    while (src->len + FEEDBLOCK + 2 > grown)
+      grown *= 2;
+    text = realloc(src->text, grown);
+    if (text == NULL)
+    {
+      fprintf(listing, "Out of memory reading the source\n");
+      exit(1);
+    }
+    src->text = text;
+    *cap = grown;
+  }
+  do
+    n = read(fd, src->text + src->len, FEEDBLOCK);
+  while (n < 0 && errno == EINTR);
+  if (n < 0)
+  {
+    fprintf(listing, "Unable to read the source: %s\n", strerror(errno));
+    Error = TRUE;
+    return -1;
+  }
+  src->len += (int)n;
+  src->text[src->len] = src->text[src->len + 1] = '\0';
+  return (int)n;
+}
+
+/* scanBlock appends to ts the tokens from *pos on
+ * that are complete: those followed by at least one
+ * more byte, since that byte might have extended
+ * them, or all of them at end of file. *line is the
+ * line *pos is on.
+ */
+static void scanBlock(Source *src, TokenStream *ts, int *pos, int *line, int eof)
+{
+  for (;;)
+  {
+    Span span;
+    int val = 0, nl = 0;
+    TokenType t = dfaToken(src, *pos, &nl, &span, &val);
+    if (!eof && span.pos + span.len >= src->len)
+      return;
+    if (t == ID)
+      val = internName(src->text + span.pos, span.len);
+    *line += nl;
+    *pos = span.pos + span.len;
+    appendToken(ts, t, span, *line, val);
+    if (t == ENDFILE)
+      return;
+  }
+}
+
+NodeId parseStream(FILE *f, void (*declared)(NodeId))
+{
+  Source *src = curSource;
+  Compilation *cc;
+  TokenStream batch = {0};
+  int fd = fileno(f), cap = FEEDBLOCK, pos = 0, line = 1;
+  int eof = FALSE, more = TRUE, failed = FALSE;
+
+  memset(src, 0, sizeof(Source));
+  src->text = malloc(cap);
+  if (src->text == NULL)
+  {
+    fprintf(listing, "Out of memory reading the source\n");
+    exit(1);
+  }
+  src->text[0] = src->text[1] = '\0';
+  cc = mainCompilation();
+  cc->declared = declared;
+  useCompilation(cc);
+  pushStart(cc);
+  while (more)
+  {
+    int n = readBlock(src, fd, &cap);
+    eof = n <= 0;
+    failed |= n < 0;
+    scanBlock(src, &batch, &pos, &line, eof);
+    if (TraceScan)
+      traceTokens(&batch);
+    while (more && batch.next < batch.count)
+      more = pushToken(cc, streamToken(&batch, cc));
+    batch.count = batch.next = 0;
+  }
+  freeTokens(&batch);
+  cc->declared = NULL;
+  if (failed)
+    cc->error = TRUE; /* the tree is not the whole program */
+  if (cc->error)
+    Error = TRUE;
+  return cc->tree;
+}
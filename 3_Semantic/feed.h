@@ -0,0 +1,23 @@
+/****************************************************/
+/* File: feed.h                                     */
+/* Streaming front end for the C-Minus compiler     */
+/****************************************************/
+
+#ifndef _FEED_H_
+#define _FEED_H_
+
+/* Function parseStream reads the program from file f
+ * into curSource as its bytes arrive, and each time
+ * some arrive, scans the tokens now complete and
+ * pushes them to the parser of the main compilation.
+ * It scans with dfaToken and parses with the yacc
+ * push parser, whatever the scanner of the compiler
+ * and DescentParse are.
+ * Unless declared is NULL, it is called on each
+ * top-level declaration as soon as it is parsed,
+ * while later input is still on its way. Returns the
+ * syntax tree, as parse does.
+ */
+NodeId parseStream(FILE *f, void (*declared)(NodeId));
+
+#endif
@@ -52,6 +52,12 @@
  */
 typedef int TokenType;
 
+/* An Atom stands for an interned identifier (see
+ * intern.h); equal names always have equal atoms
+ */
+typedef int Atom;
+#define NOATOM (-1)
+
 extern FILE *source;  /* source code text file */
 extern FILE *listing; /* listing output text file */
 extern FILE *code;    /* code text file for TM simulator */
@@ -111,30 +117,66 @@ typedef enum
   Null
 } ExpType;
 
+/* Span locates a piece of the source program as a
+ * byte offset and length into sourceText
+ */
+typedef struct
+{
+  int pos;
+  int len;
+} Span;
+
 #define MAXCHILDREN 3
 
+/* A NodeId names a syntax tree node by its index in
+ * the NodeTable of its tree. Index 0 holds no real
+ * node, so NONODE marks a missing child or sibling.
+ */
+typedef int NodeId;
+#define NONODE 0
+
+/* A node is 28 bytes: links are 32-bit indices, the
+ * kinds and the type are single bytes, and a node
+ * carries only one of an operator, a value or a name
+ * (see nodeAtom)
+ */
 typedef struct treeNode
 {
-  struct treeNode *child[MAXCHILDREN];
-  struct treeNode *sibling;
-  int lineno;
-  NodeKind nodekind;
+  NodeId child[MAXCHILDREN];
+  NodeId sibling;
+  int pos; /* byte offset in sourceText; see nodeLine */
   union
   {
-    StmtKind stmt;
-    ExpKind exp;
-    DclrKind dclr;
-    ParamKind prm;
-  } kind;
-  struct
-  {
-    TokenType op;
-    int val;
-    char *name;
+    TokenType op; /* OpK and the statements */
+    int val;      /* ConstK */
+    Atom name;    /* declarations, parameters, IdK, ArrEK, CallK */
   } attr;
-  ExpType type; /* for type checking of exps */
+  unsigned char nodekind; /* a NodeKind */
+  union
+  {
+    unsigned char stmt; /* a StmtKind */
+    unsigned char exp;  /* an ExpKind */
+    unsigned char dclr; /* a DclrKind */
+    unsigned char prm;  /* a ParamKind */
+  } kind;
+  unsigned char type; /* an ExpType, for type checking of exps */
 } TreeNode;
 
+/* A NodeTable holds all the nodes of a syntax tree
+ * in one array, so a traversal walks through memory
+ * in the order the parser built the nodes and the
+ * whole tree is freed at once
+ */
+typedef struct
+{
+  TreeNode *node; /* node[0] is the unused NONODE */
+  int count;
+  int cap;
+} NodeTable;
+
+/* nodeIn returns the node id of table tab */
+#define nodeIn(tab, id) ((tab)->node + (id))
+
 /**************************************************/
 /***********   Flags for tracing       ************/
 /**************************************************/
@@ -145,18 +187,79 @@ typedef struct treeNode
  */
 extern int EchoSource;
 
+/* MapSource = TRUE causes the source file to be mapped
+ * into memory rather than read into the source buffer
+ * the scanner works on
+ */
+extern int MapSource;
+
+/* PreScan = TRUE causes the whole source program to be
+ * scanned into a token stream before parsing starts
+ */
+extern int PreScan;
+
+/* StreamInput = TRUE causes the program to be scanned
+ * and parsed as it arrives rather than once it has
+ * all been read, each top-level declaration being
+ * entered in the symbol table as soon as it is parsed.
+ * The stream is always scanned by dfaToken, whatever
+ * scanner the compiler was built with, and parsed by
+ * the yacc push parser, so it cannot be combined with
+ * DescentParse.
+ */
+extern int StreamInput;
+
+/* ScanThreads > 1 causes the pre-scan (and the
+ * scanner-only compiler) to split the source into
+ * chunks scanned on that many threads
+ */
+extern int ScanThreads;
+
+/* ParseThreads > 1 causes the pre-scanned program to
+ * be parsed on that many threads, each taking a run
+ * of top-level declarations
+ */
+extern int ParseThreads;
+
 /* TraceScan = TRUE causes token information to be
  * printed to the listing file as each token is
  * recognized by the scanner
  */
 extern int TraceScan;
 
+/* TraceBinary = TRUE makes TraceScan record the
+ * tokens in a binary trace file, <program>.trc,
+ * instead of printing them; tracedump turns the
+ * trace back into the listing text
+ */
+extern int TraceBinary;
+
+/* CacheTree = TRUE keeps the syntax tree of the
+ * program in <program>.ast along with a hash of the
+ * source, and loads it from there instead of parsing
+ * as long as the source is unchanged
+ */
+extern int CacheTree;
+
+/* DescentParse = TRUE parses with the hand-written
+ * recursive-descent parser of parse.c instead of the
+ * yacc parser of cminus.y
+ */
+extern int DescentParse;
+
 /* TraceParse = TRUE causes the syntax tree to be
  * printed to the listing file in linearized form
  * (using indents for children)
  */
 extern int TraceParse;
 
+/* TreeDump selects the format TraceParse prints the
+ * syntax tree in, a DumpFormat (see treedump.h): the
+ * indented listing or one of the machine-readable
+ * dumps, which leave out the listing's headings
+ */
+extern int TreeDump;
+
 /* TraceAnalyze = TRUE causes symbol table inserts
  * and lookups to be reported to the listing file
  */
@@ -0,0 +1,181 @@
+/****************************************************/
+/* File: intern.c                                   */
+/* Identifier interning for the C-Minus compiler    */
+/* Atoms are indices into a table of names; the     */
+/* names themselves live in large character chunks  */
+/* and are found through an open-addressing hash    */
+/* table                                            */
+/****************************************************/
+
+#include "globals.h"
+#include "intern.h"
+#include <pthread.h>
+
+/* INITSLOTS is the initial size of the hash table;
+ * it must be a power of two
+ */
+#define INITSLOTS 1024
+
+/* CHUNKSIZE is the size of a block of name storage */
+#define CHUNKSIZE 65536
+
+typedef struct
+{
+  char *name;
+  int len;
+  unsigned hash;
+} AtomRec;
+
+/* the atoms, indexed by Atom */
+static AtomRec *atoms = NULL;
+static int natoms = 0;
+static int atomCap = 0;
+
+/* hash slots hold atom + 1, so 0 marks an empty slot */
+static int *slots = NULL;
+static int nslots = 0;
+
+/* the pool is locked only while it is shared */
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+static int shared = FALSE;
+
+/* current chunk of name storage */
+static char *chunk = NULL;
+static int chunkUsed = CHUNKSIZE;
+
+/* hashName is the FNV-1a hash of a name */
+static unsigned hashName(const char *s, int len)
+{
+  unsigned h = 2166136261u;
+  int i;
+  for (i = 0; i < len; i++)
+    h = (h ^ (unsigned char)s[i]) * 16777619u;
+  return h;
+}
+
+/* storeName copies a name into the chunk storage */
+static char *storeName(const char *s, int len)
+{
+  char *p;
+  if (len + 1 > CHUNKSIZE / 4)
+    p = malloc(len + 1); /* long names get a block of their own */
+  else
+  {
+    if (chunkUsed + len + 1 > CHUNKSIZE)
+    {
+      chunk = malloc(CHUNKSIZE);
+      chunkUsed = 0;
+      if (chunk == NULL)
+        return NULL;
+    }
+    p = chunk + chunkUsed;
+    chunkUsed += len + 1;
+  }
+  if (p == NULL)
+    return NULL;
+  memcpy(p, s, len);
+  p[len] = '\0';
+  return p;
+}
+
+/* growSlots doubles the hash table and rehashes */
+static void growSlots(void)
+{
+  int n = nslots ? nslots * 2 : INITSLOTS;
+  int *s = calloc(n, sizeof(int));
+  int i;
+  if (s == NULL)
+  {
+    fprintf(stderr, "Out of memory interning names\n");
+    exit(1);
+  }
+  for (i = 0; i < natoms; i++)
+  {
+    unsigned j = atoms[i].hash & (n - 1);
+    while (s[j] != 0)
+      j = (j + 1) & (n - 1);
+    s[j] = i + 1;
+  }
+  free(slots);
+  slots = s;
+  nslots = n;
+}
+
+/* intern does the work of internName */
+static Atom intern(const char *s, int len)
+{
+  unsigned h = hashName(s, len);
+  unsigned j;
+  AtomRec *a;
+  if (2 * (natoms + 1) > nslots)
+    growSlots();
+  j = h & (nslots - 1);
+  while (slots[j] != 0)
+  {
+    a = &atoms[slots[j] - 1];
+    if (a->hash == h && a->len == len && memcmp(a->name, s, len) == 0)
+      return slots[j] - 1;
+    j = (j + 1) & (nslots - 1);
+  }
+  if (natoms == atomCap)
+  {
+    int cap = atomCap ? atomCap * 2 : INITSLOTS / 2;
+    AtomRec *grown = realloc(atoms, cap * sizeof(AtomRec));
+    if (grown == NULL)
+    {
+      fprintf(stderr, "Out of memory interning names\n");
+      exit(1);
+    }
+    atoms = grown;
+    atomCap = cap;
+  }
+  a = &atoms[natoms];
+  a->name = storeName(s, len);
+  if (a->name == NULL)
+  {
+    fprintf(stderr, "Out of memory interning names\n");
+    exit(1);
+  }
+  a->len = len;
+  a->hash = h;
+  slots[j] = natoms + 1;
+  return natoms++;
+}
+
+Atom internName(const char *s, int len)
+{
+  Atom a;
+  if (!shared)
+    return intern(s, len);
+  pthread_mutex_lock(&poolLock);
+  a = intern(s, len);
+  pthread_mutex_unlock(&poolLock);
+  return a;
+}
+
+Atom internString(const char *s)
+{
+  return internName(s, strlen(s));
+}
+
+char *atomName(Atom a)
+{
+  char *name = NULL;
+  if (shared)
+    pthread_mutex_lock(&poolLock);
+  if (a >= 0 && a < natoms)
+    name = atoms[a].name;
+  if (shared)
+    pthread_mutex_unlock(&poolLock);
+  return name;
+}
+
+int atomCount(void)
+{
+  return natoms;
+}
+
+void internShared(int on)
+{
+  shared = on;
+}
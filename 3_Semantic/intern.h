@@ -0,0 +1,36 @@
+/****************************************************/
+/* File: intern.h                                   */
+/* Identifier interning for the C-Minus compiler    */
+/****************************************************/
+
+#ifndef _INTERN_H_
+#define _INTERN_H_
+
+/* Function internName returns the atom for the
+ * len characters at s, adding a single copy of the
+ * name to the pool the first time it is seen
+ */
+Atom internName(const char *s, int len);
+
+/* Function internString interns a NUL-terminated
+ * string
+ */
+Atom internString(const char *s);
+
+/* Function atomName returns the NUL-terminated
+ * name of atom a
+ */
+char *atomName(Atom a);
+
+/* Function atomCount returns the number of distinct
+ * names interned so far
+ */
+int atomCount(void);
+
+/* Procedure internShared turns locking of the pool
+ * on while several threads intern names at once, and
+ * off again once they are done
+ */
+void internShared(int on);
+
+#endif
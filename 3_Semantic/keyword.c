@@ -0,0 +1,58 @@
+/****************************************************/
+/* File: keyword.c                                  */
+/* Reserved word recognition for the C-Minus        */
+/* compiler, using a perfect hash on the length     */
+/* and first character of a word                    */
+/****************************************************/
+
+#include "globals.h"
+#include "keyword.h"
+
+/* KWSLOTS is the size of the keyword table */
+#define KWSLOTS 8
+
+/* KWHASH is a perfect hash of the C-Minus reserved
+ * words: (2 * first + length) mod 8 sends if, else,
+ * while, return, int and void to distinct slots.
+ * The multiplier was found by trying small constants
+ * over the word list; revisit it if MAXRESERVED
+ * changes.
+ */
+#define KWHASH(c, len) ((2 * (unsigned char)(c) + (len)) & (KWSLOTS - 1))
+
+/* shortest and longest reserved word */
+#define KWMINLEN 2
+#define KWMAXLEN 6
+
+/* slots indexed by KWHASH; empty slots have len 0 */
+static const struct
+{
+  char str[KWMAXLEN + 1];
+  int len;
+  TokenType tok;
+} keywordTable[KWSLOTS] = {
+    /* 0 */ {"void", 4, VOID},
+    /* 1 */ {"", 0, ID},
+    /* 2 */ {"return", 6, RETURN},
+    /* 3 */ {"while", 5, WHILE},
+    /* 4 */ {"if", 2, IF},
+    /* 5 */ {"int", 3, INT},
+    /* 6 */ {"else", 4, ELSE},
+    /* 7 */ {"", 0, ID},
+};
+
+TokenType keywordLookup(const char *s, int len)
+{
+  int h;
+  if (len < KWMINLEN || len > KWMAXLEN)
+    return ID;
+  h = KWHASH(s[0], len);
+  /* reject on length and first character before
+   * comparing the rest of the word
+   */
+  if (keywordTable[h].len != len || keywordTable[h].str[0] != s[0])
+    return ID;
+  if (memcmp(keywordTable[h].str + 1, s + 1, len - 1) != 0)
+    return ID;
+  return keywordTable[h].tok;
+}
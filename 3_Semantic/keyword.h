@@ -0,0 +1,17 @@
+/****************************************************/
+/* File: keyword.h                                  */
+/* Reserved word recognition for the C-Minus        */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _KEYWORD_H_
+#define _KEYWORD_H_
+
+/* Function keywordLookup returns the token of the
+ * reserved word spelled by the len characters at s,
+ * or ID if they do not spell one. s need not be
+ * NUL-terminated.
+ */
+TokenType keywordLookup(const char *s, int len);
+
+#endif
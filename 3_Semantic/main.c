@@ -6,30 +6,12 @@
 /****************************************************/
 
 #include "globals.h"
-
-/* set NO_PARSE to TRUE to get a scanner-only compiler */
-#define NO_PARSE FALSE
-/* set NO_ANALYZE to TRUE to get a parser-only compiler */
-#define NO_ANALYZE FALSE
-//#define NO_ANALYZE TRUE
-
-/* set NO_CODE to TRUE to get a compiler that does not
- * generate code
- */
-#define NO_CODE TRUE
-
+#include "source.h"
+#include "trace.h"
+#include "compile.h"
+#include "pipeline.h"
 #include "util.h"
-#if NO_PARSE
-#include "scan.h"
-#else
-#include "parse.h"
-#if !NO_ANALYZE
-#include "analyze.h"
-#if !NO_CODE
-#include "cgen.h"
-#endif
-#endif
-#endif
+#include "treedump.h"
 
 /* allocate global variables */
 int lineno = 0;
@@ -39,78 +21,171 @@ FILE *code;
 
 /* allocate and set tracing flags */
 int EchoSource = FALSE;
+int MapSource = TRUE;
+int PreScan = FALSE;
+int StreamInput = FALSE;
+int ScanThreads = 1;
+int ParseThreads = 1;
 int TraceScan = FALSE;
+int TraceBinary = FALSE;
+int CacheTree = FALSE;
+int DescentParse = FALSE;
 //int TraceParse = TRUE;
 int TraceParse = FALSE;
+int TreeDump = TextDump;
 int TraceAnalyze = FALSE;
 int TraceCode = FALSE;
 
 int Error = FALSE;
 
-main(int argc, char *argv[])
+/* reportPass is the pass hook of --time */
+static void reportPass(const char *pass, double seconds)
+{
+  fprintf(stderr, "%-10s %9.3f ms\n", pass, seconds * 1000);
+}
+
+/* countOption reads the number of an option such as
+ * --scan-threads=N into *n; it returns FALSE unless
+ * the number is a positive integer
+ */
+static int countOption(const char *arg, int *n)
+{
+  char *end;
+  long v = strtol(arg, &end, 10);
+  if (*arg == '\0' || *end != '\0' || v < 1 || v > 1024)
+    return FALSE;
+  *n = (int)v;
+  return TRUE;
+}
+
+int main(int argc, char *argv[])
 {
-  TreeNode *syntaxTree;
   char pgm[120]; /* source code file name */
-  if (argc != 2)
+  char *file = NULL;
+  Phase last = CheckPhase;
+  int i, ok, usage = FALSE;
+  for (i = 1; i < argc; i++)
+    if (strcmp(argv[i], "--lex-only") == 0)
+      last = LexPhase;
+    else if (strcmp(argv[i], "--parse-only") == 0)
+      last = ParsePhase;
+    else if (strcmp(argv[i], "--check-only") == 0)
+      last = CheckPhase;
+    else if (strcmp(argv[i], "--time") == 0)
+      passHook = reportPass;
+    else if (strcmp(argv[i], "--no-map") == 0)
+      MapSource = FALSE;
+    else if (strcmp(argv[i], "--parser=rd") == 0)
+      DescentParse = TRUE;
+    else if (strcmp(argv[i], "--parser=yacc") == 0)
+      DescentParse = FALSE;
+    else if (strcmp(argv[i], "--prescan") == 0)
+      PreScan = TRUE;
+    else if (strcmp(argv[i], "--stream") == 0)
+      StreamInput = TRUE;
+    else if (strncmp(argv[i], "--scan-threads=", 15) == 0)
+      usage |= !countOption(argv[i] + 15, &ScanThreads);
+    else if (strncmp(argv[i], "--parse-threads=", 16) == 0)
+      usage |= !countOption(argv[i] + 16, &ParseThreads);
+    else if (strcmp(argv[i], "--trace-scan") == 0)
+      TraceScan = TRUE;
+    else if (strcmp(argv[i], "--trace-binary") == 0)
+      TraceScan = TraceBinary = TRUE;
+    else if (strcmp(argv[i], "--trace-analyze") == 0)
+      TraceAnalyze = TRUE;
+    else if (strcmp(argv[i], "--cache") == 0)
+      CacheTree = TRUE;
+    else if (strncmp(argv[i], "--tree=", 7) == 0)
+    {
+      TraceParse = TRUE;
+      if (strcmp(argv[i] + 7, "text") == 0)
+        TreeDump = TextDump;
+      else if (strcmp(argv[i] + 7, "compact") == 0)
+        TreeDump = CompactDump;
+      else if (strcmp(argv[i] + 7, "json") == 0)
+        TreeDump = JsonDump;
+      else
+        usage = TRUE;
+    }
+    else if (file == NULL && (argv[i][0] != '-' || argv[i][1] == '\0'))
+      file = argv[i];
+    else
+      usage = TRUE;
+  if (file == NULL || usage)
   {
-    fprintf(stderr, "usage: %s <filename>\n", argv[0]);
+    fprintf(stderr, "usage: %s [options] <filename> (or - for standard input)\n"
+                    "  --lex-only | --parse-only | --check-only\n"
+                    "                        stop after scanning, parsing or checking (the default)\n"
+                    "  --time                report the time each pass takes on standard error\n"
+                    "  --trace-scan          list the tokens as they are scanned\n"
+                    "  --trace-binary        record them in <filename>.trc instead (see tracedump)\n"
+                    "  --tree=text|compact|json\n"
+                    "                        dump the syntax tree in the given format; compact\n"
+                    "                        and json are alone on standard output\n"
+                    "  --trace-analyze       print the symbol table and the checking passes\n"
+                    "  --parser=rd|yacc      parse by recursive descent or with the yacc tables\n"
+                    "                        (the default)\n"
+                    "  --no-map              read the source rather than mapping it into memory\n"
+                    "  --prescan             scan the whole program into tokens before parsing\n"
+                    "  --scan-threads=N      pre-scan on N threads\n"
+                    "  --parse-threads=N     parse the pre-scanned program on N threads\n"
+                    "  --stream              scan and parse the program as it is read\n"
+                    "  --cache               keep the syntax tree in <filename>.ast between runs\n",
+            argv[0]);
     exit(1);
   }
-  strcpy(pgm, argv[1]);
-  if (strchr(pgm, '.') == NULL)
-    strcat(pgm, ".tny");
-  source = fopen(pgm, "r");
-  if (source == NULL)
+  if (StreamInput && DescentParse)
   {
-    fprintf(stderr, "File %s not found\n", pgm);
+    fprintf(stderr, "%s: --stream parses with the yacc parser only\n", argv[0]);
     exit(1);
   }
-  listing = stdout; /* send listing to screen */
-  fprintf(listing, "\nC-MINUS COMPILATION: ./%s\n", pgm);
-
-#if NO_PARSE
-  while (getToken() != ENDFILE)
-    ;
-#else
-  syntaxTree = parse();
-
-  if (TraceParse)
+  if (strlen(file) + strlen(".tny") >= sizeof(pgm))
   {
-    fprintf(listing, "\nSyntax tree:\n");
-    printTree(syntaxTree);
+    fprintf(stderr, "%s: file name too long: %s\n", argv[0], file);
+    exit(1);
   }
-#if !NO_ANALYZE
-  if (!Error)
+  strcpy(pgm, file);
+  if (strcmp(pgm, "-") == 0)
+    source = stdin; /* read the program from a pipe */
+  else
   {
-    if (TraceAnalyze)
-      fprintf(listing, "\nBuilding Symbol Table...\n");
-    buildSymtab(syntaxTree);
-    if (TraceAnalyze)
-      fprintf(listing, "\nChecking Types...\n");
-    typeCheck(syntaxTree);
-    if (TraceAnalyze)
-      fprintf(listing, "\nType Checking Finished\n");
+    char *base = strrchr(pgm, '/');
+    if (strchr(base != NULL ? base + 1 : pgm, '.') == NULL)
+      strcat(pgm, ".tny");
+    source = fopen(pgm, "r");
   }
-#if !NO_CODE
-  if (!Error)
+  if (source == NULL)
   {
-    char *codefile;
-    int fnlen = strcspn(pgm, ".");
-    codefile = (char *)calloc(fnlen + 4, sizeof(char));
-    strncpy(codefile, pgm, fnlen);
-    strcat(codefile, ".tm");
-    code = fopen(codefile, "w");
-    if (code == NULL)
+    fprintf(stderr, "File %s not found\n", pgm);
+    exit(1);
+  }
+  if ((!StreamInput || last == LexPhase) && !loadSource(source))
+  {
+    fprintf(stderr, "Unable to read %s\n", pgm);
+    exit(1);
+  }
+  /* send listing to screen; a dump for other programs
+   * to read keeps standard output to itself, and the
+   * listing, errors included, goes to standard error */
+  listing = TraceParse && TreeDump != TextDump ? stderr : stdout;
+  if (TreeDump == TextDump)
+    fprintf(listing, "\nC-MINUS COMPILATION: ./%s\n", pgm);
+  if (TraceScan && TraceBinary)
+  {
+    char *tracefile = outputName(pgm, ".trc");
+    if (!openTrace(tracefile))
     {
-      printf("Unable to open %s\n", codefile);
+      fprintf(listing, "Unable to open %s\n", tracefile);
       exit(1);
     }
-    codeGen(syntaxTree, codefile);
-    fclose(code);
+    free(tracefile);
   }
-#endif
-#endif
-#endif
+
+  ok = runPipeline(pgm, last);
+  if (!closeTrace())
+    ok = FALSE;
+  freeTree(mainCompilation());
+  freeSource();
   fclose(source);
-  return 0;
+  return ok ? 0 : 1;
 }
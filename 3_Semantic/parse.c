@@ -1,215 +1,488 @@
 /****************************************************/
 /* File: parse.c                                    */
-/* The parser implementation for the TINY compiler  */
-/* Compiler Construction: Principles and Practice   */
-/* Kenneth C. Louden                                */
+/* The recursive-descent parser for C-Minus         */
+/* It builds the same trees as the yacc parser of   */
+/* cminus.y, with one function per nonterminal, but */
+/* parses the binary operators by precedence        */
+/* climbing rather than one function per level.     */
 /****************************************************/
 
 #include "globals.h"
 #include "util.h"
-#include "scan.h"
+#include "tokens.h"
 #include "parse.h"
+#include "compile.h"
+#include <setjmp.h>
 
-static TokenType token; /* holds current token */
+/* precedence levels of the binary operators; the
+ * comparisons do not associate
+ */
+#define RELOP 1
+#define ADDOP 2
+#define MULOP 3
+
+/* the state of one parse */
+typedef struct
+{
+  Compilation *cc;
+  TokenType token; /* holds current token */
+  jmp_buf fail;    /* where a syntax error ends the parse */
+} Parser;
+
+/* a Word is what the parser keeps of a keyword, type
+ * or identifier once it has moved past it
+ */
+typedef struct
+{
+  int pos;      /* where it starts in the source */
+  Atom name;    /* its name, if it is an ID */
+  ExpType type; /* the type it names, if it is one */
+} Word;
+
+/* N finds a node of the tree being built */
+#define N(id) nodeIn(&p->cc->nodes, id)
 
 /* function prototypes for recursive calls */
-static TreeNode * stmt_sequence(void);
-static TreeNode * statement(void);
-static TreeNode * if_stmt(void);
-static TreeNode * repeat_stmt(void);
-static TreeNode * assign_stmt(void);
-static TreeNode * read_stmt(void);
-static TreeNode * write_stmt(void);
-static TreeNode * exp(void);
-static TreeNode * simple_exp(void);
-static TreeNode * term(void);
-static TreeNode * factor(void);
-
-static void syntaxError(char * message)
-{ fprintf(listing,"\n>>> ");
-  fprintf(listing,"Syntax error at line %d: %s",lineno,message);
-  Error = TRUE;
-}
-
-static void match(TokenType expected)
-{ if (token == expected) token = getToken();
-  else {
-    syntaxError("unexpected token -> ");
-    printToken(token,tokenString);
-    fprintf(listing,"      ");
-  }
-}
-
-TreeNode * stmt_sequence(void)
-{ TreeNode * t = statement();
-  TreeNode * p = t;
-  while ((token!=ENDFILE) && (token!=END) &&
-         (token!=ELSE) && (token!=UNTIL))
-  { TreeNode * q;
-    match(SEMI);
-    q = statement();
-    if (q!=NULL) {
-      if (t==NULL) t = p = q;
-      else /* now p cannot be NULL either */
-      { p->sibling = q;
-        p = q;
-      }
-    }
+static NodeId statement(Parser *p);
+static NodeId expression(Parser *p);
+
+/* syntaxError reports the current token as the yacc
+ * parser does and abandons the parse
+ */
+static void syntaxError(Parser *p)
+{
+  Compilation *cc = p->cc;
+  if (cc->listing != NULL)
+  {
+    fprintf(cc->listing, "Syntax error at line %d: %s\n", cc->lineno, "syntax error");
+    fprintf(cc->listing, "Current token: ");
+    fprintToken(cc->listing, p->token, cc->source->text + cc->tokenSpan.pos,
+                cc->tokenSpan.len);
   }
+  longjmp(p->fail, 1);
+}
+
+static void advance(Parser *p)
+{
+  Compilation *cc = p->cc;
+  p->token = cc->stream != NULL ? streamToken(cc->stream, cc) : nextToken(cc);
+}
+
+static void match(Parser *p, TokenType expected)
+{
+  if (p->token != expected)
+    syntaxError(p);
+  advance(p);
+}
+
+/* word moves past the current token, which must be
+ * of type expected, and returns what it holds
+ */
+static Word word(Parser *p, TokenType expected)
+{
+  Word w;
+  if (p->token != expected)
+    syntaxError(p);
+  w.pos = p->cc->tokenSpan.pos;
+  w.name = p->cc->tokenAtom;
+  w.type = expected == INT ? Integer : Void;
+  advance(p);
+  return w;
+}
+
+/* append adds t, if there is one, to the sibling
+ * chain from *head to *tail
+ */
+static void append(Parser *p, NodeId *head, NodeId *tail, NodeId t)
+{
+  if (t == NONODE)
+    return;
+  if (*tail == NONODE)
+    *head = t;
+  else
+    N(*tail)->sibling = t;
+  *tail = t;
+}
+
+static Word type_specifier(Parser *p)
+{
+  return word(p, p->token == INT ? INT : VOID);
+}
+
+static NodeId num(Parser *p)
+{
+  NodeId t;
+  if (p->token != NUM)
+    syntaxError(p);
+  t = newExpNode(&p->cc->nodes, ConstK);
+  N(t)->pos = p->cc->tokenSpan.pos;
+  N(t)->attr.val = p->cc->tokenVal;
+  N(t)->type = Integer;
+  advance(p);
   return t;
 }
 
-TreeNode * statement(void)
-{ TreeNode * t = NULL;
-  switch (token) {
-    case IF : t = if_stmt(); break;
-    case REPEAT : t = repeat_stmt(); break;
-    case ID : t = assign_stmt(); break;
-    case READ : t = read_stmt(); break;
-    case WRITE : t = write_stmt(); break;
-    default : syntaxError("unexpected token -> ");
-              printToken(token,tokenString);
-              token = getToken();
-              break;
-  } /* end case */
+/* var_declaration parses the rest of a variable
+ * declaration whose type and name have been read
+ */
+static NodeId var_declaration(Parser *p, Word type, Word id)
+{
+  NodeId t;
+  if (p->token == LBRACE)
+  {
+    NodeId size;
+    match(p, LBRACE);
+    size = num(p);
+    match(p, RBRACE);
+    t = newDclrNode(&p->cc->nodes, ArrK);
+    N(t)->type = type.type == Integer ? IntArr : VoidArr;
+    N(t)->child[0] = size;
+  }
+  else
+  {
+    t = newDclrNode(&p->cc->nodes, VarK);
+    N(t)->type = type.type;
+  }
+  match(p, SEMI);
+  N(t)->pos = type.pos;
+  N(t)->attr.name = id.name;
   return t;
 }
 
-TreeNode * if_stmt(void)
-{ TreeNode * t = newStmtNode(IfK);
-  match(IF);
-  if (t!=NULL) t->child[0] = exp();
-  match(THEN);
-  if (t!=NULL) t->child[1] = stmt_sequence();
-  if (token==ELSE) {
-    match(ELSE);
-    if (t!=NULL) t->child[2] = stmt_sequence();
+/* param parses the rest of a parameter whose type
+ * has been read
+ */
+static NodeId param(Parser *p, Word type)
+{
+  Word id = word(p, ID);
+  NodeId t;
+  if (p->token == LBRACE)
+  {
+    match(p, LBRACE);
+    match(p, RBRACE);
+    t = newParamNode(&p->cc->nodes, ArrPK);
+    N(t)->type = type.type == Void ? VoidArr : IntArr;
+  }
+  else
+  {
+    t = newParamNode(&p->cc->nodes, NArrK);
+    N(t)->type = type.type;
   }
-  match(END);
+  N(t)->pos = type.pos;
+  N(t)->attr.name = id.name;
   return t;
 }
 
-TreeNode * repeat_stmt(void)
-{ TreeNode * t = newStmtNode(RepeatK);
-  match(REPEAT);
-  if (t!=NULL) t->child[0] = stmt_sequence();
-  match(UNTIL);
-  if (t!=NULL) t->child[1] = exp();
+static NodeId params(Parser *p)
+{
+  NodeId head = NONODE, tail = NONODE;
+  Word type = type_specifier(p);
+  if (type.type == Void && p->token == RPAREN)
+  {
+    NodeId t = newParamNode(&p->cc->nodes, NullK);
+    N(t)->pos = type.pos;
+    N(t)->type = Null;
+    return t;
+  }
+  append(p, &head, &tail, param(p, type));
+  while (p->token == COMMA)
+  {
+    match(p, COMMA);
+    type = type_specifier(p);
+    append(p, &head, &tail, param(p, type));
+  }
+  return head;
+}
+
+static NodeId compound_stmt(Parser *p)
+{
+  Word lcurly = word(p, LCURLY);
+  NodeId locals = NONODE, lastLocal = NONODE;
+  NodeId stmts = NONODE, lastStmt = NONODE;
+  NodeId t;
+  while (p->token == INT || p->token == VOID)
+  {
+    Word type = type_specifier(p);
+    Word id = word(p, ID);
+    append(p, &locals, &lastLocal, var_declaration(p, type, id));
+  }
+  while (p->token != RCURLY)
+    append(p, &stmts, &lastStmt, statement(p));
+  match(p, RCURLY);
+  t = newStmtNode(&p->cc->nodes, CompK);
+  N(t)->child[0] = locals;
+  N(t)->child[1] = stmts;
+  N(t)->pos = lcurly.pos;
   return t;
 }
 
-TreeNode * assign_stmt(void)
-{ TreeNode * t = newStmtNode(AssignK);
-  if ((t!=NULL) && (token==ID))
-    t->attr.name = copyString(tokenString);
-  match(ID);
-  match(ASSIGN);
-  if (t!=NULL) t->child[0] = exp();
+static NodeId declaration(Parser *p)
+{
+  Word type = type_specifier(p);
+  Word id = word(p, ID);
+  NodeId prms, body, t;
+  if (p->token != LPAREN)
+    return var_declaration(p, type, id);
+  match(p, LPAREN);
+  prms = params(p);
+  match(p, RPAREN);
+  body = compound_stmt(p);
+  t = newDclrNode(&p->cc->nodes, FuncK);
+  N(t)->child[0] = body;
+  N(t)->child[1] = prms;
+  N(t)->pos = type.pos;
+  N(t)->attr.name = id.name;
+  N(t)->type = type.type;
   return t;
 }
 
-TreeNode * read_stmt(void)
-{ TreeNode * t = newStmtNode(ReadK);
-  match(READ);
-  if ((t!=NULL) && (token==ID))
-    t->attr.name = copyString(tokenString);
-  match(ID);
+static NodeId declaration_list(Parser *p)
+{
+  NodeId head = NONODE, tail = NONODE;
+  do
+  {
+    NodeId t = declaration(p);
+    append(p, &head, &tail, t);
+    if (p->cc->declared != NULL)
+      p->cc->declared(t);
+  } while (p->token != ENDFILE);
+  return head;
+}
+
+static NodeId selection_stmt(Parser *p)
+{
+  Word kw = word(p, IF);
+  NodeId test, then, t;
+  match(p, LPAREN);
+  test = expression(p);
+  match(p, RPAREN);
+  then = statement(p);
+  if (p->token == ELSE)
+  {
+    NodeId otherwise;
+    match(p, ELSE);
+    otherwise = statement(p);
+    t = newStmtNode(&p->cc->nodes, ElseK);
+    N(t)->child[2] = otherwise;
+  }
+  else
+    t = newStmtNode(&p->cc->nodes, IfK);
+  N(t)->child[0] = test;
+  N(t)->child[1] = then;
+  N(t)->pos = kw.pos;
   return t;
 }
 
-TreeNode * write_stmt(void)
-{ TreeNode * t = newStmtNode(WriteK);
-  match(WRITE);
-  if (t!=NULL) t->child[0] = exp();
+static NodeId iteration_stmt(Parser *p)
+{
+  Word kw = word(p, WHILE);
+  NodeId test, body, t;
+  match(p, LPAREN);
+  test = expression(p);
+  match(p, RPAREN);
+  body = statement(p);
+  t = newStmtNode(&p->cc->nodes, WhileK);
+  N(t)->child[0] = test;
+  N(t)->child[1] = body;
+  N(t)->pos = kw.pos;
   return t;
 }
 
-TreeNode * exp(void)
-{ TreeNode * t = simple_exp();
-  if ((token==LT)||(token==EQ)) {
-    TreeNode * p = newExpNode(OpK);
-    if (p!=NULL) {
-      p->child[0] = t;
-      p->attr.op = token;
-      t = p;
-    }
-    match(token);
-    if (t!=NULL)
-      t->child[1] = simple_exp();
+static NodeId return_stmt(Parser *p)
+{
+  Word kw = word(p, RETURN);
+  NodeId t;
+  if (p->token == SEMI)
+  {
+    t = newStmtNode(&p->cc->nodes, NonReturnK);
+    N(t)->type = Void;
   }
+  else
+  {
+    NodeId value = expression(p);
+    t = newStmtNode(&p->cc->nodes, ReturnK);
+    N(t)->child[0] = value;
+    N(t)->type = Integer;
+  }
+  match(p, SEMI);
+  N(t)->pos = kw.pos;
   return t;
 }
 
-TreeNode * simple_exp(void)
-{ TreeNode * t = term();
-  while ((token==PLUS)||(token==MINUS))
-  { TreeNode * p = newExpNode(OpK);
-    if (p!=NULL) {
-      p->child[0] = t;
-      p->attr.op = token;
-      t = p;
-      match(token);
-      t->child[1] = term();
-    }
+static NodeId statement(Parser *p)
+{
+  NodeId t = NONODE;
+  switch (p->token)
+  {
+  case LCURLY:
+    return compound_stmt(p);
+  case IF:
+    return selection_stmt(p);
+  case WHILE:
+    return iteration_stmt(p);
+  case RETURN:
+    return return_stmt(p);
+  case SEMI:
+    break;
+  default:
+    t = expression(p);
   }
+  match(p, SEMI);
   return t;
 }
 
-TreeNode * term(void)
-{ TreeNode * t = factor();
-  while ((token==TIMES)||(token==OVER))
-  { TreeNode * p = newExpNode(OpK);
-    if (p!=NULL) {
-      p->child[0] = t;
-      p->attr.op = token;
-      t = p;
-      match(token);
-      p->child[1] = factor();
+/* var_or_call parses an identifier and what follows
+ * it in an expression: a call, an array element or a
+ * plain variable. Only the last two may be assigned
+ * to, which *isVar tells the caller.
+ */
+static NodeId var_or_call(Parser *p, int *isVar)
+{
+  Word id = word(p, ID);
+  NodeId t;
+  *isVar = p->token != LPAREN;
+  if (p->token == LPAREN)
+  {
+    NodeId head = NONODE, tail = NONODE;
+    match(p, LPAREN);
+    if (p->token != RPAREN)
+    {
+      append(p, &head, &tail, expression(p));
+      while (p->token == COMMA)
+      {
+        match(p, COMMA);
+        append(p, &head, &tail, expression(p));
+      }
     }
+    match(p, RPAREN);
+    t = newExpNode(&p->cc->nodes, CallK);
+    N(t)->child[0] = head;
   }
+  else if (p->token == LBRACE)
+  {
+    NodeId index;
+    match(p, LBRACE);
+    index = expression(p);
+    match(p, RBRACE);
+    t = newExpNode(&p->cc->nodes, ArrEK);
+    N(t)->child[0] = index;
+  }
+  else
+    t = newExpNode(&p->cc->nodes, IdK);
+  N(t)->pos = id.pos;
+  N(t)->attr.name = id.name;
   return t;
 }
 
-TreeNode * factor(void)
-{ TreeNode * t = NULL;
-  switch (token) {
-    case NUM :
-      t = newExpNode(ConstK);
-      if ((t!=NULL) && (token==NUM))
-        t->attr.val = atoi(tokenString);
-      match(NUM);
-      break;
-    case ID :
-      t = newExpNode(IdK);
-      if ((t!=NULL) && (token==ID))
-        t->attr.name = copyString(tokenString);
-      match(ID);
-      break;
-    case LPAREN :
-      match(LPAREN);
-      t = exp();
-      match(RPAREN);
-      break;
-    default:
-      syntaxError("unexpected token -> ");
-      printToken(token,tokenString);
-      token = getToken();
-      break;
-    }
-  return t;
+static NodeId factor(Parser *p)
+{
+  NodeId t;
+  int isVar;
+  switch (p->token)
+  {
+  case NUM:
+    return num(p);
+  case ID:
+    return var_or_call(p, &isVar);
+  case LPAREN:
+    match(p, LPAREN);
+    t = expression(p);
+    match(p, RPAREN);
+    return t;
+  default:
+    syntaxError(p);
+    return NONODE;
+  }
 }
 
-/****************************************/
-/* the primary function of the parser   */
-/****************************************/
-/* Function parse returns the newly 
- * constructed syntax tree
+/* precedence returns the level of binary operator
+ * op, or 0 if op is not one
  */
-TreeNode * parse(void)
-{ TreeNode * t;
-  token = getToken();
-  t = stmt_sequence();
-  if (token!=ENDFILE)
-    syntaxError("Code ends before file\n");
-  return t;
+static int precedence(TokenType op)
+{
+  switch (op)
+  {
+  case LT:
+  case LE:
+  case GT:
+  case GE:
+  case EQ:
+  case NE:
+    return RELOP;
+  case PLUS:
+  case MINUS:
+    return ADDOP;
+  case TIMES:
+  case OVER:
+    return MULOP;
+  default:
+    return 0;
+  }
+}
+
+/* binary_expression extends the operand left with
+ * the operators of level minPrec and above, each
+ * operand in turn taking in the operators that bind
+ * tighter than the one before it. A comparison ends
+ * the expression, as the grammar allows only one.
+ */
+static NodeId binary_expression(Parser *p, NodeId left, int minPrec)
+{
+  int prec;
+  while ((prec = precedence(p->token)) >= minPrec)
+  {
+    TokenType op = p->token;
+    NodeId right, t;
+    advance(p);
+    right = factor(p);
+    while (precedence(p->token) > prec)
+      right = binary_expression(p, right, prec + 1);
+    t = newExpNode(&p->cc->nodes, OpK);
+    N(t)->child[0] = left;
+    N(t)->child[1] = right;
+    N(t)->pos = N(left)->pos;
+    N(t)->attr.op = op;
+    left = t;
+    if (prec == RELOP)
+      break;
+  }
+  return left;
+}
+
+static NodeId expression(Parser *p)
+{
+  NodeId left;
+  int isVar;
+  if (p->token != ID)
+    return binary_expression(p, factor(p), RELOP);
+  left = var_or_call(p, &isVar);
+  if (isVar && p->token == ASSIGN)
+  {
+    NodeId value, t;
+    match(p, ASSIGN);
+    value = expression(p);
+    t = newStmtNode(&p->cc->nodes, AssignK);
+    N(t)->child[0] = left;
+    N(t)->child[1] = value;
+    N(t)->pos = N(left)->pos;
+    return t;
+  }
+  return binary_expression(p, left, RELOP);
+}
+
+NodeId descentParse(Compilation *cc)
+{
+  Parser p;
+  p.cc = cc;
+  cc->tree = NONODE;
+  cc->error = FALSE;
+  if (setjmp(p.fail))
+  {
+    cc->error = TRUE;
+    cc->tree = NONODE;
+    return NONODE;
+  }
+  advance(&p);
+  cc->tree = declaration_list(&p);
+  return cc->tree;
 }
@@ -9,8 +9,43 @@
 #define _PARSE_H_
 
 /* Function parse returns the newly 
- * constructed syntax tree
+ * constructed syntax tree and makes it curTree
  */
-TreeNode * parse(void);
+NodeId parse(void);
+
+/* Function parseTokens builds the syntax tree from
+ * a token stream filled by scanTokens instead of
+ * calling the scanner
+ */
+NodeId parseTokens(TokenStream *);
+
+/* Function parseCompilation parses the program of
+ * compilation cc, from cc->stream if it is set and
+ * from the scanner otherwise, and returns its syntax
+ * tree, which is also left in cc->tree. It touches
+ * no globals, so several compilations may be parsed
+ * at once.
+ */
+struct compilation;
+NodeId parseCompilation(struct compilation *);
+
+/* Function descentParse is the recursive-descent
+ * parser parseCompilation runs in place of the yacc
+ * parser when DescentParse is set. It builds the
+ * same tree and reports the same syntax errors.
+ */
+NodeId descentParse(struct compilation *);
+
+/* Procedure pushStart and function pushToken run a
+ * push parse of compilation cc with the yacc parser:
+ * pushStart readies it, and pushToken hands it one
+ * token, whose lexeme, span and value are already
+ * in cc as streamToken leaves them. pushToken returns
+ * TRUE as long as the parser wants more tokens; once
+ * it returns FALSE, after ENDFILE or a syntax error,
+ * cc->tree and cc->error hold the outcome.
+ */
+void pushStart(struct compilation *);
+int pushToken(struct compilation *, TokenType);
 
 #endif
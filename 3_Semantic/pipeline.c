@@ -0,0 +1,166 @@
+/****************************************************/
+/* File: pipeline.c                                 */
+/* The passes of a C-Minus compilation              */
+/* The compiler runs as a table of passes, each     */
+/* belonging to a phase, so one binary can stop     */
+/* after any phase and every pass can be timed.     */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "scan.h"
+#include "tokens.h"
+#include "plex.h"
+#include "pparse.h"
+#include "feed.h"
+#include "compile.h"
+#include "astcache.h"
+#include "parse.h"
+#include "analyze.h"
+#include "treedump.h"
+#include "pipeline.h"
+#include <time.h>
+
+void (*passHook)(const char *pass, double seconds) = NULL;
+
+/* what the passes hand on to each other */
+static Phase lastPhase;
+static TokenStream tokens;  /* the pre-scanned program */
+static int scanned = FALSE; /* TRUE once tokens holds it */
+static char *cachefile = NULL;
+static int cached = FALSE;  /* TRUE if the tree came from cachefile */
+static NodeId syntaxTree = NONODE;
+
+/* scanPass scans the whole program ahead of the
+ * parser when only the tokens are wanted or the
+ * parser is to work on a token stream; otherwise
+ * the parser calls the scanner as it goes
+ */
+static int scanPass(void)
+{
+  if (cached || (StreamInput && lastPhase > LexPhase))
+    return FALSE;
+  if (lastPhase == LexPhase && ScanThreads <= 1)
+  {
+    while (getToken() != ENDFILE)
+      ;
+    return TRUE;
+  }
+  if (lastPhase > LexPhase && !PreScan && ParseThreads <= 1)
+    return FALSE;
+  if (ScanThreads > 1)
+    scanParallel(&tokens, ScanThreads);
+  else
+    scanTokens(&tokens);
+  scanned = TRUE;
+  return TRUE;
+}
+
+static int parsePass(void)
+{
+  if (cached)
+  {
+    useCompilation(mainCompilation());
+    syntaxTree = mainCompilation()->tree;
+  }
+  else if (StreamInput)
+    syntaxTree = parseStream(source, lastPhase >= CheckPhase ? declareSymbols : NULL);
+  else if (scanned && ParseThreads > 1)
+    syntaxTree = parseParallel(&tokens, ParseThreads);
+  else if (scanned)
+    syntaxTree = parseTokens(&tokens);
+  else
+    syntaxTree = parse();
+  if (scanned)
+    freeTokens(&tokens);
+  scanned = FALSE;
+  if (cachefile != NULL && !cached && !Error)
+    saveTree(cachefile, mainCompilation());
+
+  if (TraceParse)
+  {
+    if (TreeDump == TextDump)
+      fprintf(listing, "\nSyntax tree:\n");
+    dumpTree(TreeDump == TextDump ? listing : stdout, syntaxTree, TreeDump);
+  }
+  return TRUE;
+}
+
+static int symtabPass(void)
+{
+  if (TraceAnalyze)
+    fprintf(listing, "\nBuilding Symbol Table...\n");
+  if (StreamInput)
+    finishSymtab();
+  else
+    buildSymtab(syntaxTree);
+  return TRUE;
+}
+
+static int typeCheckPass(void)
+{
+  if (TraceAnalyze)
+    fprintf(listing, "\nChecking Types...\n");
+  typeCheck(syntaxTree);
+  if (TraceAnalyze)
+    fprintf(listing, "\nType Checking Finished\n");
+  return TRUE;
+}
+
+typedef struct
+{
+  const char *name;
+  Phase phase;
+  /* run returns FALSE if the pass had nothing to do */
+  int (*run)(void);
+} Pass;
+
+/* the passes, in the order they run */
+static const Pass passes[] = {
+    {"scan", LexPhase, scanPass},
+    {"parse", ParsePhase, parsePass},
+    {"symtab", CheckPhase, symtabPass},
+    {"typecheck", CheckPhase, typeCheckPass},
+};
+
+#define NPASSES ((int)(sizeof(passes) / sizeof(passes[0])))
+
+/* now returns the time in seconds from some fixed
+ * point in the past
+ */
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int runPipeline(char *pgm, Phase last)
+{
+  int i;
+  lastPhase = last;
+  /* a cached tree skips the scanner, so not while its
+   * output is wanted, and standard input has no name
+   * to keep the cache under */
+  if (last >= ParsePhase && CacheTree && !TraceScan && !EchoSource &&
+      !StreamInput && source != stdin)
+    cachefile = outputName(pgm, ".ast");
+  cached = cachefile != NULL && loadTree(cachefile, mainCompilation());
+  for (i = 0; i < NPASSES && passes[i].phase <= last; i++)
+  {
+    double start;
+    /* the checks need a whole tree; errors they find
+     * themselves do not stop the passes after them */
+    if (passes[i].phase > ParsePhase && mainCompilation()->error)
+      break;
+    start = now();
+    if (passes[i].run() && passHook != NULL)
+      passHook(passes[i].name, now() - start);
+  }
+  free(cachefile);
+  cachefile = NULL;
+  if (scanned)
+    freeTokens(&tokens);
+  scanned = FALSE;
+  return !Error;
+}
@@ -0,0 +1,34 @@
+/****************************************************/
+/* File: pipeline.h                                 */
+/* The passes of a C-Minus compilation              */
+/****************************************************/
+
+#ifndef _PIPELINE_H_
+#define _PIPELINE_H_
+
+/* the phases of a compilation, in the order they
+ * run; each is made of one or more passes
+ */
+typedef enum
+{
+  LexPhase,
+  ParsePhase,
+  CheckPhase
+} Phase;
+
+/* passHook, if set, is called after each pass that
+ * did some work with its name and the time it took
+ * in seconds
+ */
+extern void (*passHook)(const char *pass, double seconds);
+
+/* Function runPipeline compiles the program in the
+ * source file, which is named pgm, running the passes
+ * of every phase up to and including last. Unless
+ * StreamInput is set, the file must already be loaded
+ * into curSource. The checks are skipped after a
+ * syntax error. Returns FALSE if any pass found errors.
+ */
+int runPipeline(char *pgm, Phase last);
+
+#endif
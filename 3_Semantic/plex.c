@@ -0,0 +1,187 @@
+/****************************************************/
+/* File: plex.c                                     */
+/* Parallel chunked scanning for the C-Minus        */
+/* compiler                                         */
+/* The source is cut into chunks at line breaks and */
+/* every chunk is scanned on its own thread on the  */
+/* guess that it does not start inside a comment.   */
+/* The chunks are then stitched in order; where the */
+/* guess was wrong, the chunk is re-scanned from    */
+/* the true position only until its token starts    */
+/* line up with the guessed ones again.             */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include "intern.h"
+#include "dfa.h"
+#include "tokens.h"
+#include "plex.h"
+#include <pthread.h>
+
+/* MINCHUNK is the smallest chunk worth a thread */
+#define MINCHUNK 65536
+
+/* MAXCHUNKS bounds the number of threads used */
+#define MAXCHUNKS 64
+
+typedef struct
+{
+  int start;     /* first byte of the chunk */
+  int stop;      /* tokens starting here or later belong to the next chunk */
+  int resume;    /* start of the first token at or after stop, or sourceLen */
+  int resumeNl;  /* newlines between start and resume */
+  int newlines;  /* newlines between start and stop */
+  TokenStream ts; /* tokens; line holds newlines since start */
+} Chunk;
+
+/* scanChunk is the thread body: it scans the tokens
+ * starting in [start, stop) of one chunk
+ */
+static void *scanChunk(void *arg)
+{
+  Chunk *c = (Chunk *)arg;
+  int pos = c->start, nl = 0;
+  c->newlines = countNewlines(sourceText + c->start, c->stop - c->start);
+  for (;;)
+  {
+    Span span;
+    int val = 0;
+    TokenType t = dfaToken(curSource, pos, &nl, &span, &val);
+    if (t == ENDFILE || span.pos >= c->stop)
+    {
+      c->resume = span.pos;
+      c->resumeNl = nl;
+      return NULL;
+    }
+    appendToken(&c->ts, t, span, nl, val);
+    pos = span.pos + span.len;
+  }
+}
+
+/* findStart returns the index of the token of c
+ * that starts at pos, or -1 if no token does
+ */
+static int findStart(Chunk *c, int pos)
+{
+  int lo = 0, hi = c->ts.count - 1;
+  while (lo <= hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (c->ts.span[mid].pos < pos)
+      lo = mid + 1;
+    else if (c->ts.span[mid].pos > pos)
+      hi = mid - 1;
+    else
+      return mid;
+  }
+  return -1;
+}
+
+/* emitToken appends a token with its final line
+ * number, interning identifiers on the way; atoms
+ * are handed out here, on one thread, so the intern
+ * pool needs no locking
+ */
+static void emitToken(TokenStream *ts, TokenType t, Span span, int line, int val)
+{
+  if (t == ID)
+    val = internName(sourceText + span.pos, span.len);
+  appendToken(ts, t, span, line, val);
+}
+
+void scanParallel(TokenStream *ts, int nthreads)
+{
+  Chunk chunks[MAXCHUNKS];
+  pthread_t threads[MAXCHUNKS];
+  int started[MAXCHUNKS];
+  int n, k, pos, r, line, base;
+  Span eof;
+
+  /* cut the source into chunks ending at line breaks */
+  n = nthreads;
+  if (n > MAXCHUNKS)
+    n = MAXCHUNKS;
+  if (n > sourceLen / MINCHUNK)
+    n = sourceLen / MINCHUNK;
+  if (n < 1)
+    n = 1;
+  pos = 0;
+  for (k = 0; k < n; k++)
+  {
+    int stop = (int)((long long)sourceLen * (k + 1) / n);
+    const char *brk;
+    if (stop < pos)
+      stop = pos;
+    brk = k == n - 1 ? NULL : memchr(sourceText + stop, '\n', sourceLen - stop);
+    stop = brk == NULL ? sourceLen : (int)(brk - sourceText) + 1;
+    memset(&chunks[k], 0, sizeof(Chunk));
+    chunks[k].start = pos;
+    chunks[k].stop = stop;
+    pos = stop;
+  }
+  n = k;
+
+  /* scan every chunk on the guess that it starts
+   * outside a comment
+   */
+  for (k = 1; k < n; k++)
+    started[k] = pthread_create(&threads[k], NULL, scanChunk, &chunks[k]) == 0;
+  scanChunk(&chunks[0]);
+  for (k = 1; k < n; k++)
+    if (started[k])
+      pthread_join(threads[k], NULL);
+    else
+      scanChunk(&chunks[k]);
+
+  /* stitch the chunks in order. r is the true start
+   * of the next token and line its line number.
+   */
+  r = 0;
+  line = 1;
+  base = 1;
+  for (k = 0; k < n; k++)
+  {
+    Chunk *c = &chunks[k];
+    int p = r;
+    int nl = r < c->stop ? countNewlines(sourceText + c->start, r - c->start) : 0;
+    /* when the previous chunk ended exactly at our
+     * start the guess holds from our first token on;
+     * otherwise it ran past it (through a comment,
+     * usually) and we scan from r until a token starts
+     * where the guessed scan also had one
+     */
+    while (r < c->stop)
+    {
+      Span span;
+      int val = 0, i;
+      TokenType t = dfaToken(curSource, p, &nl, &span, &val);
+      if (t == ENDFILE || span.pos >= c->stop)
+      {
+        r = span.pos;
+        line = base + nl;
+        break;
+      }
+      if ((i = findStart(c, span.pos)) >= 0)
+      {
+        for (; i < c->ts.count; i++)
+          emitToken(ts, c->ts.kind[i], c->ts.span[i], base + c->ts.line[i], c->ts.val[i]);
+        r = c->resume;
+        line = base + c->resumeNl;
+        break;
+      }
+      emitToken(ts, t, span, base + nl, val);
+      p = span.pos + span.len;
+    }
+    /* the line index is filled in order, here */
+    markLines(curSource, c->start, c->stop - c->start);
+    base += c->newlines;
+    freeTokens(&c->ts);
+  }
+  eof.pos = sourceLen;
+  eof.len = 0;
+  appendToken(ts, ENDFILE, eof, line, 0);
+  ts->next = 0;
+  if (TraceScan)
+    traceTokens(ts);
+}
@@ -0,0 +1,17 @@
+/****************************************************/
+/* File: plex.h                                     */
+/* Parallel chunked scanning for the C-Minus        */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _PLEX_H_
+#define _PLEX_H_
+
+/* Procedure scanParallel fills ts with the tokens of
+ * sourceText, splitting the work across up to
+ * nthreads threads. The result is the same token
+ * stream scanTokens produces with the flex scanner.
+ */
+void scanParallel(TokenStream *ts, int nthreads);
+
+#endif
@@ -0,0 +1,226 @@
+/****************************************************/
+/* File: pparse.c                                   */
+/* Parallel parsing of top-level declarations for   */
+/* the C-Minus compiler                             */
+/* The token stream is cut after top-level          */
+/* declarations into parts of about equal size and  */
+/* every part is parsed on its own thread into its  */
+/* own node table. A program is a declaration list, */
+/* so if every part parses, the program is the      */
+/* parts one after another: the tables are copied   */
+/* into one in order and the declaration lists are  */
+/* joined. If a part does not parse, the program is */
+/* parsed again serially for its error message.     */
+/* The copying is done on the threads as well.      */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "tokens.h"
+#include "parse.h"
+#include "compile.h"
+#include "pparse.h"
+#include <pthread.h>
+
+/* MINPART is the fewest tokens worth a thread */
+#define MINPART 16384
+
+/* MAXPARTS bounds the number of threads used */
+#define MAXPARTS 64
+
+typedef struct
+{
+  TokenStream ts; /* the tokens of the part, inside the whole stream */
+  Compilation cc; /* parses them into a node table of its own */
+  NodeTable *tab; /* the table of the whole program */
+  NodeId base;    /* where the nodes of the part go in it, less one */
+  NodeId first;   /* the first and last declarations of the part */
+  NodeId last;    /* once copied, or NONODE */
+} Part;
+
+/* parsePart is the first thread body: it parses one
+ * part
+ */
+static void *parsePart(void *arg)
+{
+  Part *part = (Part *)arg;
+  parseCompilation(&part->cc);
+  return NULL;
+}
+
+/* copyPart is the second thread body: it copies the
+ * nodes of one part to their place in the table of
+ * the whole program, renumbering the links
+ */
+static void *copyPart(void *arg)
+{
+  Part *part = (Part *)arg;
+  NodeTable *from = &part->cc.nodes;
+  TreeNode *to = part->tab->node + part->base;
+  NodeId base = part->base, t;
+  int i, j;
+  for (i = 1; i < from->count; i++)
+  {
+    to[i] = from->node[i];
+    for (j = 0; j < MAXCHILDREN; j++)
+      if (to[i].child[j] != NONODE)
+        to[i].child[j] += base;
+    if (to[i].sibling != NONODE)
+      to[i].sibling += base;
+  }
+  part->first = part->last = NONODE;
+  if (part->cc.tree == NONODE)
+    return NULL;
+  part->first = part->cc.tree + base;
+  for (t = part->first; part->tab->node[t].sibling != NONODE; t = part->tab->node[t].sibling)
+    ;
+  part->last = t;
+  return NULL;
+}
+
+/* runParts runs body on each of the n parts, the
+ * first on this thread and the others on threads of
+ * their own
+ */
+static void runParts(Part *parts, int n, void *(*body)(void *))
+{
+  pthread_t threads[MAXPARTS];
+  int started[MAXPARTS];
+  int k;
+  for (k = 1; k < n; k++)
+    started[k] = pthread_create(&threads[k], NULL, body, &parts[k]) == 0;
+  body(&parts[0]);
+  for (k = 1; k < n; k++)
+    if (started[k])
+      pthread_join(threads[k], NULL);
+    else
+      body(&parts[k]);
+}
+
+/* splitStream cuts the tokens of ts, less its
+ * ENDFILE, into at most n parts, each ending with a
+ * ';' or a '}' outside all braces, which is where a
+ * top-level declaration ends. Returns the number of
+ * parts.
+ */
+static int splitStream(TokenStream *ts, Part *parts, int n)
+{
+  int end = ts->count - 1; /* the ENDFILE */
+  int i, k = 0, start = 0, depth = 0;
+  for (i = 0; i < end && k < n - 1; i++)
+  {
+    if (ts->kind[i] == LCURLY)
+      depth++;
+    else if (ts->kind[i] == RCURLY)
+      depth--;
+    else if (ts->kind[i] != SEMI)
+      continue;
+    /* a part ends at the first declaration end past
+     * its share of what the earlier parts left */
+    if (depth == 0 && i + 1 - start >= (end - start) / (n - k))
+    {
+      parts[k++].ts.count = i + 1 - start;
+      start = i + 1;
+    }
+  }
+  if (start < end)
+    parts[k++].ts.count = end - start;
+  for (i = 0, start = 0; i < k; i++)
+  {
+    TokenStream *p = &parts[i].ts;
+    p->cap = p->count;
+    p->next = 0;
+    p->kind = ts->kind + start;
+    p->span = ts->span + start;
+    p->line = ts->line + start;
+    p->val = ts->val + start;
+    start += p->count;
+  }
+  return k;
+}
+
+/* joinParts copies the node tables of the n parts
+ * into the one of cc, part after part, and chains
+ * their declaration lists into cc->tree. The nodes
+ * come out numbered as a serial parse numbers them.
+ */
+static void joinParts(Compilation *cc, Part *parts, int n)
+{
+  NodeTable *tab = &cc->nodes;
+  NodeId last = NONODE;
+  int k, total = 1;
+  for (k = 0; k < n; k++)
+  {
+    parts[k].tab = tab;
+    parts[k].base = total - 1;
+    total += parts[k].cc.nodes.count - 1;
+  }
+  freeNodes(tab);
+  tab->node = malloc(total * sizeof(TreeNode));
+  if (tab->node == NULL)
+  {
+    fprintf(listing, "Out of memory joining %d parsed parts\n", n);
+    exit(1);
+  }
+  memset(tab->node, 0, sizeof(TreeNode)); /* the NONODE */
+  tab->count = tab->cap = total;
+  runParts(parts, n, copyPart);
+  cc->tree = NONODE;
+  for (k = 0; k < n; k++)
+  {
+    if (parts[k].first == NONODE)
+      continue;
+    if (last == NONODE)
+      cc->tree = parts[k].first;
+    else
+      tab->node[last].sibling = parts[k].first;
+    last = parts[k].last;
+  }
+}
+
+NodeId parseParallel(TokenStream *ts, int nthreads)
+{
+  Compilation *cc = mainCompilation();
+  Part parts[MAXPARTS];
+  int n, k, failed = FALSE;
+
+  n = nthreads;
+  if (n > MAXPARTS)
+    n = MAXPARTS;
+  if (n > ts->count / MINPART)
+    n = ts->count / MINPART;
+  if (n > 1)
+    n = splitStream(ts, parts, n);
+  if (n <= 1)
+    return parseTokens(ts);
+
+  /* the parts share the source text, which they only
+   * read, and keep their syntax errors to themselves */
+  for (k = 0; k < n; k++)
+  {
+    Compilation *pc = &parts[k].cc;
+    memset(pc, 0, sizeof(Compilation));
+    pc->source = cc->source;
+    pc->listing = NULL;
+    pc->stream = &parts[k].ts;
+    pc->tokenAtom = NOATOM;
+  }
+  runParts(parts, n, parsePart);
+
+  for (k = 0; k < n; k++)
+    failed |= parts[k].cc.error;
+  if (!failed)
+  {
+    cc->error = FALSE;
+    joinParts(cc, parts, n);
+  }
+  for (k = 0; k < n; k++)
+    freeTree(&parts[k].cc);
+  if (failed)
+  {
+    ts->next = 0;
+    return parseTokens(ts);
+  }
+  useCompilation(cc);
+  return cc->tree;
+}
@@ -0,0 +1,18 @@
+/****************************************************/
+/* File: pparse.h                                   */
+/* Parallel parsing of top-level declarations for   */
+/* the C-Minus compiler                             */
+/****************************************************/
+
+#ifndef _PPARSE_H_
+#define _PPARSE_H_
+
+/* Function parseParallel parses the token stream ts
+ * of the main compilation like parseTokens, splitting
+ * its top-level declarations across up to nthreads
+ * threads. The tree, its node numbering and any
+ * syntax error are the same as parseTokens gives.
+ */
+NodeId parseParallel(TokenStream *ts, int nthreads);
+
+#endif
@@ -0,0 +1,126 @@
+/****************************************************/
+/* File: relex.c                                    */
+/* Incremental re-scanning of edited sources for    */
+/* the C-Minus compiler                             */
+/* Tokens never span a newline or sit inside a      */
+/* comment, so the scanner is in its start state at */
+/* every token boundary, and what it returns from a */
+/* boundary on depends only on the text from there  */
+/* on. An edit therefore only changes the tokens    */
+/* between the last boundary before it and the      */
+/* first boundary after it that the old and the new */
+/* scan share.                                      */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include "intern.h"
+#include "tokens.h"
+#include "dfa.h"
+#include "relex.h"
+
+/* firstReached returns the index of the first token
+ * of ts an edit at pos can change: the first one
+ * ending at or after pos. A token that ends right at
+ * pos may grow into the inserted text, but no rule
+ * looks further than one byte past its token.
+ */
+static int firstReached(TokenStream *ts, int pos)
+{
+  int lo = 0, hi = ts->count - 1;
+  while (lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (ts->span[mid].pos + ts->span[mid].len < pos)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+/* findStart returns the index of the token of ts at
+ * or after index from that starts at pos, or -1
+ */
+static int findStart(TokenStream *ts, int from, int pos)
+{
+  int lo = from, hi = ts->count - 1;
+  while (lo <= hi)
+  {
+    int mid = (lo + hi) / 2;
+    if (ts->span[mid].pos < pos)
+      lo = mid + 1;
+    else if (ts->span[mid].pos > pos)
+      hi = mid - 1;
+    else
+      return mid;
+  }
+  return -1;
+}
+
+void relexTokens(TokenStream *old, Source *src, int pos, int removed,
+                 int inserted, TokenDelta *d)
+{
+  int k = firstReached(old, pos);
+  int p = k > 0 ? old->span[k - 1].pos + old->span[k - 1].len : 0;
+  int line = k > 0 ? old->line[k - 1] : 1;
+  int editEnd = pos + inserted;
+  memset(d, 0, sizeof(TokenDelta));
+  d->first = k;
+  d->shift = inserted - removed;
+  for (;;)
+  {
+    Span span;
+    int val = 0, j;
+    TokenType t = dfaToken(src, p, &line, &span, &val);
+    if (span.pos >= editEnd &&
+        (j = findStart(old, k, span.pos - d->shift)) >= 0)
+    {
+      d->removed = j - k;
+      d->lineShift = line - old->line[j];
+      return;
+    }
+    if (t == ID)
+      val = internName(src->text + span.pos, span.len);
+    appendToken(&d->added, t, span, line, val);
+    if (t == ENDFILE)
+    { /* only if old did not end in its ENDFILE */
+      d->removed = old->count - k;
+      return;
+    }
+    p = span.pos + span.len;
+  }
+}
+
+void applyDelta(TokenStream *ts, TokenDelta *d)
+{
+  int tail = d->first + d->removed;
+  int rest = ts->count - tail;
+  int at = d->first + d->added.count;
+  int n = d->added.count;
+  int i;
+  reserveTokens(ts, at + rest);
+  memmove(ts->kind + at, ts->kind + tail, rest * sizeof(TokenType));
+  memmove(ts->span + at, ts->span + tail, rest * sizeof(Span));
+  memmove(ts->line + at, ts->line + tail, rest * sizeof(int));
+  memmove(ts->val + at, ts->val + tail, rest * sizeof(int));
+  for (i = at; i < at + rest; i++)
+  {
+    ts->span[i].pos += d->shift;
+    ts->line[i] += d->lineShift;
+  }
+  if (n > 0)
+  {
+    memcpy(ts->kind + d->first, d->added.kind, n * sizeof(TokenType));
+    memcpy(ts->span + d->first, d->added.span, n * sizeof(Span));
+    memcpy(ts->line + d->first, d->added.line, n * sizeof(int));
+    memcpy(ts->val + d->first, d->added.val, n * sizeof(int));
+  }
+  ts->count = at + rest;
+  ts->next = 0;
+}
+
+void freeDelta(TokenDelta *d)
+{
+  freeTokens(&d->added);
+}
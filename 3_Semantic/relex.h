@@ -0,0 +1,44 @@
+/****************************************************/
+/* File: relex.h                                    */
+/* Incremental re-scanning of edited sources for    */
+/* the C-Minus compiler                             */
+/****************************************************/
+
+#ifndef _RELEX_H_
+#define _RELEX_H_
+
+/* A TokenDelta describes how a token stream changes
+ * under an edit: the removed tokens starting at index
+ * first are replaced by the tokens in added, and every
+ * token after them moves by shift bytes and lineShift
+ * lines
+ */
+typedef struct
+{
+  int first;
+  int removed;
+  TokenStream added;
+  int shift;
+  int lineShift;
+} TokenDelta;
+
+/* Procedure relexTokens works out the delta d for the
+ * token stream old of a source in which the removed
+ * bytes at offset pos were replaced by inserted bytes,
+ * giving src. Scanning restarts at the last token
+ * boundary the edit cannot reach and stops as soon as
+ * a token starts where an old one did after the
+ * edit, since from there on the text is the same.
+ */
+void relexTokens(TokenStream *old, Source *src, int pos, int removed,
+                 int inserted, TokenDelta *d);
+
+/* Procedure applyDelta turns ts into the token stream
+ * of the edited source
+ */
+void applyDelta(TokenStream *ts, TokenDelta *d);
+
+/* Procedure freeDelta releases the tokens of d */
+void freeDelta(TokenDelta *d);
+
+#endif
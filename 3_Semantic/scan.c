@@ -8,13 +8,17 @@
 #include "globals.h"
 #include "util.h"
 #include "scan.h"
+#include "intern.h"
+#include "keyword.h"
+#include "source.h"
+#include "compile.h"
+#include <limits.h>
 
 /* states in scanner DFA */
 typedef enum
 {
 	START,
 	INASSIGN,
-	INCOMMENT,
 	INNUM,
 	INID,
 	DONE,
@@ -26,95 +30,117 @@ typedef enum
 	INCOMMENT_
 } StateType;
 
-/* lexeme of identifier or reserved word */
-char tokenString[MAXTOKENLEN + 1];
+/* this scanner keeps its state in the statics
+ * below, so it serves one compilation at a time
+ */
+const int ScanReentrant = FALSE;
 
-/* BUFLEN = length of the input buffer for
-   source code lines */
-#define BUFLEN 256
+/* the compilation being scanned */
+static Compilation *cur = NULL;
 
-static char lineBuf[BUFLEN]; /* holds the current line */
-static int linepos = 0;		 /* current position in LineBuf */
-static int bufsize = 0;		 /* current size of buffer string */
+/* the scanner reads straight out of the source
+ * buffer, which loadSource fills in large blocks
+ * (or maps) whether the source is a file, a pipe or
+ * standard input, so lines may be of any length
+ */
+static const char *text = NULL; /* the source text */
+static int textLen = 0;		/* its length */
+static int textPos = 0;		/* offset of the next character */
+static int echoPos = 0;		/* offset of the first line not yet echoed */
 static int EOF_flag = FALSE; /* corrects ungetNextChar behavior on EOF */
 
-/* getNextChar fetches the next non-blank character
-   from lineBuf, reading in a new line if lineBuf is
-   exhausted */
-static int getNextChar(void)
+/* echoLines echoes every line not yet echoed up to
+   and including the one holding the next character */
+static void echoLines(void)
 {
-	if (!(linepos < bufsize))
+	while (echoPos <= textPos && echoPos < textLen)
 	{
-		lineno++;
-		if (fgets(lineBuf, BUFLEN - 1, source))
-		{
-			if (EchoSource)
-				fprintf(listing, "%4d: %s", lineno, lineBuf);
-			bufsize = strlen(lineBuf);
-			linepos = 0;
-			return lineBuf[linepos++];
-		}
-		else
-		{
-			EOF_flag = TRUE;
-			return EOF;
-		}
+		const char *nl = memchr(text + echoPos, '\n', textLen - echoPos);
+		int end = nl == NULL ? textLen : (int)(nl - text) + 1;
+		fprintf(cur->listing, "%4d: %.*s", lineOf(cur->source, echoPos),
+				end - echoPos, text + echoPos);
+		echoPos = end;
 	}
-	else
-		return lineBuf[linepos++];
+}
+
+/* getNextChar fetches the next character from the
+   source buffer, or EOF at its end */
+static int getNextChar(void)
+{
+	if (EchoSource && textPos >= echoPos)
+		echoLines();
+	if (textPos < textLen)
+		return (unsigned char)text[textPos++];
+	EOF_flag = TRUE;
+	return EOF;
 }
 
 /* ungetNextChar backtracks one character
-   in lineBuf */
+   in the source buffer */
 static void ungetNextChar(void)
 {
 	if (!EOF_flag)
-		linepos--;
+		textPos--;
 }
 
-/* lookup table of reserved words */
-static struct
+/* skipBlanks skips the run of blanks the blank just
+   read starts, counting its lines in bulk */
+static void skipBlanks(void)
 {
-	char *str;
-	TokenType tok;
-} reservedWords[MAXRESERVED] = {
-	{"if", IF},
-	{"else", ELSE},
-	{"while", WHILE},
-	{"return", RETURN},
-	{"int", INT},
-	{"void", VOID},
-};
+	int from = textPos - 1;
+	while (textPos < textLen && (text[textPos] == ' ' || text[textPos] == '\t' ||
+								 text[textPos] == '\n'))
+		textPos++;
+	cur->lineno += markLines(cur->source, from, textPos - from);
+}
 
-/* lookup an identifier to see if it is a reserved word */
-/* uses linear search */
-static TokenType reservedLookup(char *s)
+/* skipCommentBody skips a comment whose opening has
+   just been read, counting its lines in bulk */
+static void skipCommentBody(void)
 {
-	int i;
-	for (i = 0; i < MAXRESERVED; i++)
-		if (!strcmp(s, reservedWords[i].str))
-			return reservedWords[i].tok;
-	return ID;
+	const char *end = skipComment(text + textPos, text + textLen, NULL);
+	cur->lineno += markLines(cur->source, textPos, end - text - textPos);
+	textPos = end - text;
+}
+
+void initScanner(Compilation *cc)
+{
+	cur = cc;
+	text = cc->source->text;
+	textLen = cc->source->len;
+	textPos = echoPos = 0;
+	EOF_flag = FALSE;
+	cc->lineno = 1;
+}
+
+void freeScanner(Compilation *cc)
+{
+	if (cur == cc)
+		cur = NULL;
 }
 
 /****************************************/
 /* the primary function of the scanner  */
 /****************************************/
-/* function getToken returns the
+/* function scanToken returns the
  * next token in source file
  */
-TokenType getToken(void)
-{ /* index for storing into tokenString */
-	int tokenStringIndex = 0;
-	/* holds current token to be returned */
+TokenType scanToken(Compilation *cc)
+{ /* holds current token to be returned */
 	TokenType currentToken;
 	/* current state - always begins at START */
 	StateType state = START;
-	/* flag to indicate save to tokenString */
+	/* flag to indicate the character is part of the token */
 	int save;
+	/* value of a number, and whether it left the int range */
+	unsigned value = 0;
+	int overflow = FALSE;
+	Span *tokenSpan = &cc->tokenSpan;
+	tokenSpan->len = 0;
 	while (state != DONE)
 	{ // state가 done이 되면 토큰을 그만 받고 출력
 		int c = getNextChar();
+		int cpos = textPos - 1; /* source offset of c */
 		save = TRUE;
 		switch (state)
 		{ // id, number, whitespace, other 19symbols
@@ -123,7 +149,10 @@ TokenType getToken(void)
 		  // =, == 구별 필요
 		case START:
 			if (isdigit(c))
+			{
 				state = INNUM;
+				value = c - '0';
+			}
 			else if (isalpha(c))
 				state = INID; //변수는 알파벳과 숫자 모두 가능
 			else if (c == '=')
@@ -132,14 +161,17 @@ TokenType getToken(void)
 			}
 			// else if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'))
 			else if ((c == ' ') || (c == '\t') || (c == '\n'))
+			{
 				save = FALSE;
+				skipBlanks();
+			}
 			else if (c == '/')
 			{
 				int temp = getNextChar();
 				if (temp == '*')
 				{ // 주석
 					save = FALSE;
-					state = INCOMMENT;
+					skipCommentBody();
 				}
 				else
 				{
@@ -167,10 +199,6 @@ TokenType getToken(void)
 				state = DONE;
 				switch (c)
 				{
-				case '\0':
-					save = FALSE;
-					currentToken = ENDFILE;
-					break;
 				case EOF:
 					save = FALSE;
 					currentToken = ENDFILE;
@@ -187,7 +215,7 @@ TokenType getToken(void)
 				case '*': //=> *와 주석 구분
 					currentToken = TIMES;
 					break;
-					/*case '/': // => /과 주석 구분 /*~**
+					/*case '/': // => /과 주석 구분
 					  currentToken = OVER;
 					  break;*/
 				case '(':
@@ -273,30 +301,20 @@ TokenType getToken(void)
 				currentToken = ERROR;
 			}
 			break;
-		case INCOMMENT: // 주석
-			state = INCOMMENT;
-			save = FALSE;
-			if (c == EOF || c == '\0')
-			{
-				state = DONE;
-				currentToken = ENDFILE;
-			}
-			else if (c == '*')
-			{
-				int temp = getNextChar();
-				if (temp == '/')
-					state = START;
-				else
-					ungetNextChar();
-			}
-			break;
 		case INNUM:
 			if (!isdigit(c))
 			{ /* backup in the input */
 				ungetNextChar();
 				save = FALSE;
 				state = DONE;
-				currentToken = NUM;
+				currentToken = overflow ? ERROR : NUM;
+				cc->tokenVal = (int)value;
+			}
+			else
+			{
+				if (value > (INT_MAX - (unsigned)(c - '0')) / 10)
+					overflow = TRUE;
+				value = value * 10 + (c - '0');
 			}
 			break;
 		case INID:
@@ -310,24 +328,20 @@ TokenType getToken(void)
 			break;
 		case DONE:
 		default: /* should never happen */
-			fprintf(listing, "Scanner Bug: state= %d\n", state);
+			fprintf(cc->listing, "Scanner Bug: state= %d\n", state);
 			state = DONE;
 			currentToken = ERROR;
 			break;
 		}
-		if ((save) && (tokenStringIndex <= MAXTOKENLEN))
-			tokenString[tokenStringIndex++] = (char)c;
-		if (state == DONE)
-		{
-			tokenString[tokenStringIndex] = '\0';
+		if ((save) && (tokenSpan->len++ == 0))
+			tokenSpan->pos = cpos;
+		if (state == DONE && currentToken == ID)
+		{ /* the lexeme is the token's span of the source */
+			const char *lexeme = text + tokenSpan->pos;
+			currentToken = keywordLookup(lexeme, tokenSpan->len); // 예약어인지 확인하는 작업
 			if (currentToken == ID)
-				currentToken = reservedLookup(tokenString); // 예약어인지 확인하는 작업
+				cc->tokenAtom = internName(lexeme, tokenSpan->len);
 		}
 	}
-	if (TraceScan)
-	{
-		fprintf(listing, "\t%d: ", lineno);
-		printToken(currentToken, tokenString);
-	}
 	return currentToken;
-} /* end getToken */
+} /* end scanToken */
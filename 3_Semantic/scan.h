@@ -8,15 +8,48 @@
 #ifndef _SCAN_H_
 #define _SCAN_H_
 
-/* MAXTOKENLEN is the maximum size of a token */
-#define MAXTOKENLEN 40
+/* the following describe the token getToken last
+ * returned; every Compilation keeps its own copy
+ */
+
+/* tokenSpan locates the current token in sourceText;
+ * its lexeme is the tokenSpan.len bytes there
+ */
+extern Span tokenSpan;
+
+/* tokenAtom is the interned name of the current
+ * token when it is an ID
+ */
+extern Atom tokenAtom;
 
-/* tokenString array stores the lexeme of each token */
-extern char tokenString[MAXTOKENLEN+1];
+/* tokenVal is the value of the current token when
+ * it is a NUM, worked out as its digits are matched.
+ * A literal too large for an int is scanned as an
+ * ERROR token instead.
+ */
+extern int tokenVal;
 
 /* function getToken returns the 
  * next token in source file
  */
 TokenType getToken(void);
 
+/* Every scanner provides the following three
+ * functions. initScanner readies the scanner for the
+ * source of cc, scanToken returns its next token,
+ * leaving the lexeme, span, atom, value and line in
+ * cc, and
+ * freeScanner releases what initScanner set up.
+ */
+struct compilation;
+void initScanner(struct compilation *cc);
+TokenType scanToken(struct compilation *cc);
+void freeScanner(struct compilation *cc);
+
+/* ScanReentrant is TRUE if the scanner keeps all of
+ * its state in the Compilation, so that several
+ * compilations may be scanned at once
+ */
+extern const int ScanReentrant;
+
 #endif
@@ -0,0 +1,243 @@
+/****************************************************/
+/* File: source.c                                   */
+/* Whole-file source buffer implementation for the  */
+/* C-Minus compiler                                 */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* READCHUNK is the initial buffer size used when the
+ * source cannot be mapped and has to be read instead
+ */
+#define READCHUNK 65536
+
+/* mainSource backs curSource unless a compilation
+ * (see compile.h) makes its own source current
+ */
+static Source mainSource;
+Source *curSource = &mainSource;
+
+/* mapSource maps the regular file fd of the given size.
+ * An anonymous, zero-filled region two bytes longer than
+ * the file is reserved first and the file is mapped over
+ * its start, so the NUL terminators always exist even
+ * when the file ends exactly on a page boundary. The
+ * mapping is private and writable because flex stores
+ * its hold character into the buffer while scanning.
+ */
+static int mapSource(Source *src, int fd, size_t size)
+{
+  char *base;
+  base = mmap(NULL, size + 2, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED)
+    return FALSE;
+  if (mmap(base, size, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+  {
+    munmap(base, size + 2);
+    return FALSE;
+  }
+  src->text = base;
+  src->len = (int)size;
+  src->mapLen = size + 2;
+  return TRUE;
+}
+
+/* readSource reads f up to end of file into a
+ * malloc'ed buffer that grows geometrically
+ */
+static int readSource(Source *src, FILE *f)
+{
+  size_t cap = READCHUNK, len = 0, n;
+  char *buf = malloc(cap);
+  if (buf == NULL)
+    return FALSE;
+  while ((n = fread(buf + len, 1, cap - len - 2, f)) > 0)
+  {
+    len += n;
+    if (cap - len - 2 == 0)
+    {
+      char *grown = realloc(buf, cap * 2);
+      if (grown == NULL)
+      {
+        free(buf);
+        return FALSE;
+      }
+      buf = grown;
+      cap *= 2;
+    }
+  }
+  buf[len] = buf[len + 1] = '\0';
+  src->text = buf;
+  src->len = (int)len;
+  src->mapLen = 0;
+  return TRUE;
+}
+
+int openSource(Source *src, FILE *f)
+{
+  struct stat st;
+  int fd = fileno(f);
+  int regular = fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+  memset(src, 0, sizeof(Source));
+  if (MapSource && regular && st.st_size > 0 && ftell(f) == 0 &&
+      mapSource(src, fd, (size_t)st.st_size))
+    return TRUE;
+  if (!readSource(src, f))
+    return FALSE;
+  if (regular)
+    rewind(f);
+  return TRUE;
+}
+
+int loadSource(FILE *f)
+{
+  return openSource(curSource, f);
+}
+
+void closeSource(Source *src)
+{
+  if (src->text != NULL)
+  {
+    if (src->mapLen > 0)
+      munmap(src->text, src->mapLen);
+    else
+      free(src->text);
+  }
+  free(src->lineStarts);
+  memset(src, 0, sizeof(Source));
+}
+
+void freeSource(void)
+{
+  closeSource(curSource);
+}
+
+/* both of the following lean on memchr, which the C
+ * library implements with wide loads, so long comment
+ * blocks are crossed a word or vector at a time
+ * rather than a character at a time
+ */
+int countNewlines(const char *s, int len)
+{
+  const char *end = s + len;
+  int n = 0;
+  while ((s = memchr(s, '\n', end - s)) != NULL)
+  {
+    n++;
+    s++;
+  }
+  return n;
+}
+
+const char *skipComment(const char *s, const char *end, int *lines)
+{
+  const char *p = s;
+  const char *stop = end;
+  while ((p = memchr(p, '*', end - p)) != NULL && p + 1 < end)
+  {
+    if (p[1] == '/')
+    {
+      stop = p + 2;
+      break;
+    }
+    p++;
+  }
+  if (lines != NULL)
+    *lines += countNewlines(s, stop - s);
+  return stop;
+}
+
+/* addLine appends a line start to the line index */
+static void addLine(Source *src, int start)
+{
+  if (src->nlines == src->lineCap)
+  {
+    int cap = src->lineCap ? src->lineCap * 2 : (int)(READCHUNK / sizeof(int));
+    int *grown = realloc(src->lineStarts, cap * sizeof(int));
+    if (grown == NULL)
+    {
+      fprintf(stderr, "Out of memory indexing lines\n");
+      exit(1);
+    }
+    src->lineStarts = grown;
+    src->lineCap = cap;
+  }
+  src->lineStarts[src->nlines++] = start;
+}
+
+int markLines(Source *src, int pos, int len)
+{
+  const char *s = src->text + pos;
+  const char *end = s + len;
+  int n = 0;
+  if (src->nlines == 0)
+    addLine(src, 0);
+  while ((s = memchr(s, '\n', end - s)) != NULL)
+  {
+    int start = (int)(++s - src->text);
+    if (start > src->lineStarts[src->nlines - 1])
+      addLine(src, start);
+    n++;
+  }
+  if (pos + len > src->indexed)
+    src->indexed = pos + len;
+  return n;
+}
+
+/* findLine returns the index in lineStarts of the
+ * line holding pos. Tokens never span a newline, so
+ * if the scanners have not reached pos yet the gap
+ * is simply indexed here.
+ */
+static int findLine(Source *src, int pos)
+{
+  int lo = 0, hi;
+  if (pos > src->len)
+    pos = src->len;
+  if (pos < 0)
+    pos = 0;
+  if (src->nlines == 0 || pos > src->indexed)
+    markLines(src, src->indexed, pos - src->indexed);
+  hi = src->nlines - 1;
+  while (lo < hi)
+  {
+    int mid = (lo + hi + 1) / 2;
+    if (src->lineStarts[mid] <= pos)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+int lineOf(Source *src, int pos)
+{
+  return findLine(src, pos) + 1;
+}
+
+int columnOf(Source *src, int pos)
+{
+  return pos - src->lineStarts[findLine(src, pos)] + 1;
+}
+
+/* NEARLINES is the most lines lineNear steps over */
+#define NEARLINES 8
+
+int lineNear(Source *src, int pos, int hint)
+{
+  int i = hint - 1, n;
+  if (i < 0 || i >= src->nlines || pos > src->indexed ||
+      pos > src->len || src->lineStarts[i] > pos)
+    return lineOf(src, pos);
+  for (n = 0; n < NEARLINES; n++, i++)
+    if (i + 1 == src->nlines || src->lineStarts[i + 1] > pos)
+      return i + 1;
+  return lineOf(src, pos);
+}
+
@@ -0,0 +1,96 @@
+/****************************************************/
+/* File: source.h                                   */
+/* Whole-file source buffer for the C-Minus         */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _SOURCE_H_
+#define _SOURCE_H_
+
+/* A Source is the entire text of one source program
+ * followed by two NUL bytes, which is the end-of-buffer
+ * marker flex expects from yy_scan_buffer, together
+ * with the index of its line starts
+ */
+typedef struct
+{
+  char *text;      /* the program and its two NULs */
+  int len;         /* length, not counting the NULs */
+  size_t mapLen;   /* length of the mapping backing text,
+                    * or 0 if text was malloc'ed */
+  int *lineStarts; /* lineStarts[i] is the offset of line i + 1 */
+  int nlines;
+  int lineCap;
+  int indexed;     /* the index accounts for every newline
+                    * among the first indexed bytes */
+} Source;
+
+/* curSource is the source the scanner-level globals
+ * (getToken, scanParallel) and the analyzer work on
+ */
+extern Source *curSource;
+
+/* sourceText and sourceLen are the text and length
+ * of curSource
+ */
+#define sourceText (curSource->text)
+#define sourceLen (curSource->len)
+
+/* Function openSource makes the whole of file f
+ * available in src. Regular files are mapped into
+ * memory when MapSource is set; anything else is
+ * read in one go, and a regular file is then rewound
+ * so it can still be read through stdio. Returns
+ * FALSE if it fails.
+ */
+int openSource(Source *src, FILE *f);
+
+/* Procedure closeSource releases the text and the
+ * line index of src
+ */
+void closeSource(Source *src);
+
+/* Function loadSource opens file f as curSource */
+int loadSource(FILE *f);
+
+/* Procedure freeSource closes curSource */
+void freeSource(void);
+
+/* Function countNewlines returns the number of
+ * newline characters among the len bytes at s
+ */
+int countNewlines(const char *s, int len);
+
+/* Function skipComment returns the position just
+ * past the end of a comment whose body starts at s,
+ * or end if the comment is not terminated before
+ * end. The newlines skipped are added to *lines
+ * unless lines is NULL.
+ */
+const char *skipComment(const char *s, const char *end, int *lines);
+
+/* Function markLines adds the lines starting inside
+ * the len bytes at offset pos of src to its line index
+ * and returns the number of newlines among them. The
+ * scanners call it on the text between tokens, so the
+ * index is built as the source is scanned.
+ */
+int markLines(Source *src, int pos, int len);
+
+/* Functions lineOf and columnOf map the byte offset
+ * pos in src to its line and column, both counted
+ * from 1, by binary search in the line index
+ */
+int lineOf(Source *src, int pos);
+int columnOf(Source *src, int pos);
+
+/* Function lineNear is lineOf for an offset at or a
+ * little after the start of line hint, where a walk
+ * over the program in source order finds the next
+ * offset it looks up; it then takes a step or two
+ * instead of a search, and falls back on one if pos
+ * is elsewhere
+ */
+int lineNear(Source *src, int pos, int hint);
+
+#endif
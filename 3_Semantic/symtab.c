@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "symtab.h"
+#include "intern.h"
 
 /* SIZE is the size of the hash table */
 #define SIZE 3269
@@ -20,7 +21,15 @@
    in hash function  */
 #define SHIFT 4
 
-/* the list of line numbers of the source 
+/* the hash function; names are interned, so a
+ * symbol is hashed on its scope and name atoms
+ * rather than on their characters
+ */
+static int hash ( Atom scope, Atom name )
+{ return (int)((((unsigned)scope << SHIFT) + (unsigned)name) % SIZE);
+}
+
+/* the list of line numbers of the source
  * code in which a variable is referenced
  */
 typedef struct LineListRec
@@ -29,7 +38,7 @@ typedef struct LineListRec
    } * LineList;
 
 /* The record in the bucket lists for
- * each variable, including name, 
+ * each variable, including name,
  * assigned memory location, and
  * the list of line numbers in which
  * it appears in the source code
@@ -40,72 +49,89 @@ typedef struct LineListRec
  } * ParamList;
 
 typedef struct BucketListRec
-   { char * name;
+   { Atom name;
      ExpType type;
      LineList lines;
      ParamList params;
-     char * scope;
+     Atom scope;
      int cntparam;
-     //char * scope;
      int memloc ; /* memory location for variable */
      struct BucketListRec * next;
    } * BucketList;
 
+/* a scope records its enclosing scope so lookups
+ * can walk outwards to the global scope
+ */
 typedef struct ScopeListRec
 {
-  char * name;
-  BucketList bucket;  // Similar Role of Global Scope
+  Atom name;
   struct ScopeListRec * parent;
+  struct ScopeListRec * next;
 } * ScopeList;
 
-/* the hash table */ // Role of Global Scope
-//static BucketList hashTable[SIZE];
-static ScopeList Table;
+/* the hash table of symbols, keyed on (scope, name) */
+static BucketList hashTable[SIZE];
 
-void make_table(char * parScope, char * newScope){
-  ScopeList newNode = (ScopeList)malloc(sizeof(struct ScopeListRec));
-  newNode -> name = newScope;
-  for(int i =0;i<SIZE;i++){
-    newNode->bucket[i]=NULL;
-  }
-  newNode -> parent = parScope;
-  int h = hash(newScope);
-  hashTable[h] = newNode;
-}
+/* the hash table of scopes, keyed on the scope atom */
+static ScopeList scopeTable[SIZE];
 
+/* findScope returns the scope named by atom s */
+static ScopeList findScope(Atom s)
+{ ScopeList l = scopeTable[hash(s, 0)];
+  while ((l != NULL) && (l->name != s))
+    l = l->next;
+  return l;
+}
 
-void delete_table(char * parScope, char * newScope){
-  int h = hash(newScope);
-  free(hashTable[h]);
-  
+/* findSymbol returns the record of name declared
+ * directly in scope, or NULL
+ */
+static BucketList findSymbol(Atom scope, Atom name)
+{ BucketList b = hashTable[hash(scope, name)];
+  while ((b != NULL) && ((b->scope != scope) || (b->name != name)))
+    b = b->next;
+  return b;
 }
 
+void make_table(Atom parScope, Atom newScope){
+  int h = hash(newScope, 0);
+  ScopeList newNode = (ScopeList)malloc(sizeof(struct ScopeListRec));
+  newNode -> name = newScope;
+  newNode -> parent = (parScope == NOATOM) ? NULL : findScope(parScope);
+  newNode -> next = scopeTable[h];
+  scopeTable[h] = newNode;
+}
 
+/* Procedure delete_table closes a scope. Its
+ * symbols stay in the table so that the printed
+ * symbol table still lists them.
+ */
+void delete_table(Atom parScope, Atom newScope){
+  (void)parScope;
+  (void)newScope;
+}
 
 /* Procedure st_insert inserts line numbers and
  * memory locations into the symbol table
  * loc = memory location is inserted only the
  * first time, otherwise ignored
  */
- void st_insert(char* scope, char * name, ExpType type, int lineno, int loc ){
-  int h = hash(scope);
-  ScopeList l = hashTable[h]; // a Scope
-  int hh = hash(name);
-  BucketList b = l->bucket[hh];
-
-  while ((b != NULL) && (strcmp(name,b->name) != 0)) // look same scope
-    b = b->next;
+ void st_insert(Atom scope, Atom name, ExpType type, int lineno, int loc ){
+  BucketList b = findSymbol(scope, name);
   if (b == NULL) /* variable not yet in table */
-  { b = (BucketList) malloc(sizeof(struct BucketListRec));
+  { int h = hash(scope, name);
+    b = (BucketList) malloc(sizeof(struct BucketListRec));
     b->name = name;
+    b->scope = scope;
+    b->type = type;
     b->lines = (LineList) malloc(sizeof(struct LineListRec));
     b->lines->lineno = lineno;
     b->params = NULL;
     b->cntparam=-1;
     b->memloc = loc;
     b->lines->next = NULL;
-    b->next = l->bucket[hh];
-    l->bucket[hh] = b; }
+    b->next = hashTable[h];
+    hashTable[h] = b; }
   else /* found in table, so just add line number */
   { LineList t = b->lines;
     while (t->next != NULL) t = t->next;
@@ -114,105 +140,66 @@ void delete_table(char * parScope, char * newScope){
     t->next->next = NULL;
   }
  }
-/*
-void st_insert( char * name, int lineno, int loc )
-{ int h = hash(name);
-  BucketList l =  hashTable[h];
-  while ((l != NULL) && (strcmp(name,l->name) != 0))
-    l = l->next;
-  if (l == NULL)
-  { l = (BucketList) malloc(sizeof(struct BucketListRec));
-    l->name = name;
-    l->lines = (LineList) malloc(sizeof(struct LineListRec));
-    l->lines->lineno = lineno;
-    l->memloc = loc;
-    l->lines->next = NULL;
-    l->next = hashTable[h];
-    hashTable[h] = l; }
-  else 
-  { LineList t = l->lines;
-    while (t->next != NULL) t = t->next;
-    t->next = (LineList) malloc(sizeof(struct LineListRec));
-    t->next->lineno = lineno;
-    t->next->next = NULL;
-  }
-} 
-*/
 
-/* Function st_lookup returns the memory 
- * location of a variable or -1 if not found
+/* Function st_lookup returns the type of name as
+ * seen from scope, searching the enclosing scopes
+ * outwards, or -1 if it is not declared
  */
-
-
-int st_lookup ( char* scope, char * name )
- { 
-
-  int h = hash(scope);
-  ScopeList l = hashTable[h]; // a Scope
-  int hh = hash(name);
-  BucketList b = l->bucket[hh];
-  while(strcmp(l->name,"global")!=0){
-  while ((b != NULL) && (strcmp(name,b->name) != 0))
-    b = b->next;
-  if (b != NULL) {
-    return b->type;
-  }
-  else {
-    l=l->parent;
-    b = l->bucket[hh];
-    continue;
+int st_lookup ( Atom scope, Atom name )
+{ ScopeList l = findScope(scope);
+  while (l != NULL)
+  { BucketList b = findSymbol(l->name, name);
+    if (b != NULL) return b->type;
+    l = l->parent;
   }
+  return -1;
 }
-  while ((b != NULL) && (strcmp(name,b->name) != 0))
-    b = b->next;
+
+int st_lookup_excluding_parent ( Atom scope, Atom name ){
+  BucketList b = findSymbol(scope, name);
   if (b != NULL) {
     return b->type;
   }
   else {
     return -1;
   }
- }
-
-int st_lookup_excluding_parent ( char* scope, char * name ){
-  int h = hash(scope);
-  ScopeList l = hashTable[h]; // a Scope
-  int hh = hash(name);
-  BucketList b = l->bucket[hh];
-  while ((b != NULL) && (strcmp(name,b->name) != 0))
-    b = b->next;
-  if (b != NULL) {
+}
 
-    return b->type;
+/* Procedure setparams records the count parameters
+ * of the global function name, whose types are in
+ * types
+ */
+void setparams(Atom name, int count, const ExpType * types){
+  BucketList b = findSymbol(internString("global"), name);
+  ParamList * last;
+  int i;
+  if (b == NULL) return;
+  b->cntparam = count;
+  last = &b->params;
+  for (i = 0; i < count; i++)
+  { *last = (ParamList) malloc(sizeof(struct Param));
+    (*last)->type = types[i];
+    (*last)->next = NULL;
+    last = &(*last)->next;
   }
-  else {
-
-    return -1;
-}
 }
-int getnumparam(char * name){
-  {
-  int h = hash("global");
-  ScopeList l = hashTable[h]; // a Scope
-  int hh = hash(name);
-  BucketList b = l->bucket[hh];
-
-  while ((b != NULL) && (strcmp(name,b->name) != 0)) // look same scope
-    b = b->next;
-    return b->cntparam;
- }
+
+int getnumparam(Atom name){
+  BucketList b = findSymbol(internString("global"), name);
+  if (b == NULL) return -1;
+  return b->cntparam;
 }
-/*
-int st_lookup ( char * name )
-{ int h = hash(name);
-  BucketList l =  hashTable[h];
-  while ((l != NULL) && (strcmp(name,l->name) != 0))
-    l = l->next;
-  if (l == NULL) return -1;
-  else return l->memloc;
+
+int getparamtype(Atom name, int i){
+  BucketList b = findSymbol(internString("global"), name);
+  ParamList p;
+  if (b == NULL) return -1;
+  for (p = b->params; p != NULL && i > 0; p = p->next) i--;
+  return p == NULL ? -1 : (int)p->type;
 }
-*/
-/* Procedure printSymTab prints a formatted 
- * listing of the symbol table contents 
+
+/* Procedure printSymTab prints a formatted
+ * listing of the symbol table contents
  * to the listing file
  */
 void printSymTab(FILE * listing)
@@ -224,7 +211,7 @@ void printSymTab(FILE * listing)
     { BucketList l = hashTable[i];
       while (l != NULL)
       { LineList t = l->lines;
-        fprintf(listing,"%-14s ",l->name);
+        fprintf(listing,"%-14s ",atomName(l->name));
         fprintf(listing,"%-8d  ",l->memloc);
         while (t != NULL)
         { fprintf(listing,"%4d ",t->lineno);
@@ -16,16 +16,24 @@
  * first time, otherwise ignored
  */
 //void st_insert( char * name, int lineno, int loc );
-void st_insert(char* scope, char * name, ExpType type, int lineno, int loc );
-void make_table(char * parScope, char * newScope);
-void delete_table(char * parScope, char * newScope);
+void st_insert(Atom scope, Atom name, ExpType type, int lineno, int loc );
+void make_table(Atom parScope, Atom newScope);
+void delete_table(Atom parScope, Atom newScope);
 /* Function st_lookup returns the memory 
  * location of a variable or -1 if not found
  */
 //int st_lookup ( char * name );
-int st_lookup ( char* scope, char * name );
-int st_lookup_excluding_parent ( char* scope, char * name );
-int getnumparam(char * name);
+int st_lookup ( Atom scope, Atom name );
+int st_lookup_excluding_parent ( Atom scope, Atom name );
+/* Procedure setparams records the number and the
+ * types of the parameters of global function name;
+ * getnumparam returns that number, or -1 if name is
+ * not a function, and getparamtype the type of
+ * parameter i, or -1 if it has none
+ */
+void setparams(Atom name, int count, const ExpType * types);
+int getnumparam(Atom name);
+int getparamtype(Atom name, int i);
 /* Procedure printSymTab prints a formatted 
  * listing of the symbol table contents 
  * to the listing file
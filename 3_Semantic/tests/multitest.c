@@ -0,0 +1,135 @@
+/****************************************************/
+/* File: multitest.c                                */
+/* Checks compileFiles against serial parses        */
+/* usage: multitest file...                         */
+/* Parses each file on its own, then COPIES of them */
+/* all at once with compileFiles, one thread each,  */
+/* with the yacc and the recursive-descent parser;  */
+/* every tree parsed at once must equal the serial  */
+/* one, node for node                               */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include "intern.h"
+#include "compile.h"
+#include "parse.h"
+
+/* globals the shared modules expect */
+int lineno = 0;
+FILE *source;
+FILE *listing;
+int MapSource = TRUE;
+int TraceScan = FALSE;
+int TraceBinary = FALSE;
+int DescentParse = FALSE;
+int Error = FALSE;
+
+/* COPIES is how many times each file is parsed at
+ * once, so that threads parsing the same text and
+ * interning the same names run side by side
+ */
+#define COPIES 4
+
+/* sameTree reports the first node where the trees of
+ * a and b differ and returns FALSE, or returns TRUE
+ */
+static int sameTree(Compilation *a, Compilation *b)
+{
+  int i;
+  if (a->error != b->error || a->tree != b->tree ||
+      a->nodes.count != b->nodes.count)
+  {
+    fprintf(stderr, "%s: error %d, root %d, %d nodes;"
+                    " at once error %d, root %d, %d nodes\n",
+            a->name, a->error, a->tree, a->nodes.count, b->error, b->tree,
+            b->nodes.count);
+    return FALSE;
+  }
+  for (i = 1; i < a->nodes.count; i++)
+  {
+    TreeNode *s = nodeIn(&a->nodes, i), *t = nodeIn(&b->nodes, i);
+    if (s->child[0] != t->child[0] || s->child[1] != t->child[1] ||
+        s->child[2] != t->child[2] || s->sibling != t->sibling ||
+        s->pos != t->pos || s->attr.val != t->attr.val ||
+        s->nodekind != t->nodekind || s->kind.stmt != t->kind.stmt ||
+        s->type != t->type)
+    {
+      fprintf(stderr, "%s: node %d differs when parsed at once\n",
+              a->name, i);
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/* check parses the n files named in names with the
+ * parser DescentParse selects and returns the number
+ * of trees that differ
+ */
+static int check(char **names, int n)
+{
+  Compilation *serial = calloc(n, sizeof(Compilation));
+  Compilation *cs = calloc(n * COPIES, sizeof(Compilation));
+  char **copies = malloc(n * COPIES * sizeof(char *));
+  int k, got, failed = 0, differ = 0;
+  if (serial == NULL || cs == NULL || copies == NULL)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(1);
+  }
+  for (k = 0; k < n; k++)
+  {
+    if (!openCompilation(&serial[k], names[k], listing))
+      exit(1);
+    parseCompilation(&serial[k]);
+    failed += serial[k].error;
+  }
+  for (k = 0; k < n * COPIES; k++)
+    copies[k] = names[k % n];
+  got = compileFiles(cs, copies, n * COPIES, listing);
+  if (got != failed * COPIES)
+  {
+    fprintf(stderr, "compileFiles failed on %d files, expected %d\n", got,
+            failed * COPIES);
+    differ++;
+  }
+  for (k = 0; k < n * COPIES; k++)
+  {
+    differ += !sameTree(&serial[k % n], &cs[k]);
+    closeCompilation(&cs[k]);
+    freeTree(&cs[k]);
+  }
+  for (k = 0; k < n; k++)
+  {
+    closeCompilation(&serial[k]);
+    freeTree(&serial[k]);
+  }
+  free(serial);
+  free(cs);
+  free(copies);
+  return differ;
+}
+
+int main(int argc, char *argv[])
+{
+  int differ;
+  if (argc < 2)
+  {
+    fprintf(stderr, "usage: %s file...\n", argv[0]);
+    exit(1);
+  }
+  /* syntax errors are expected; only the trees
+   * are compared */
+  listing = fopen("/dev/null", "w");
+  if (listing == NULL)
+    listing = stderr;
+  differ = check(argv + 1, argc - 1);
+  DescentParse = TRUE;
+  differ += check(argv + 1, argc - 1);
+  if (differ > 0)
+    return 1;
+  printf("multitest: %d files, %d at once, both parsers ok\n", argc - 1,
+         (argc - 1) * COPIES);
+  return 0;
+}
@@ -0,0 +1,161 @@
+/****************************************************/
+/* File: relextest.c                                */
+/* Checks relexTokens against a full re-scan        */
+/* usage: relextest [seed [edits]]                  */
+/* Makes random edits to a random program; after    */
+/* each one the token stream patched with the delta */
+/* must equal the one a fresh scan of the edited    */
+/* program gives, token for token                   */
+/****************************************************/
+
+#include "globals.h"
+#include "source.h"
+#include "intern.h"
+#include "tokens.h"
+#include "dfa.h"
+#include "relex.h"
+
+/* globals the shared modules expect */
+int lineno = 0;
+FILE *source;
+FILE *listing;
+int MapSource = TRUE;
+int TraceScan = FALSE;
+int TraceBinary = FALSE;
+int DescentParse = FALSE;
+int Error = FALSE;
+
+/* the pieces programs and edits are made of, chosen
+ * to put tokens next to each other in every way that
+ * can join, split or end them: the halves of two-byte
+ * operators and of comment brackets, numbers too large
+ * for an int, keywords and their prefixes, and bytes
+ * no token starts with
+ */
+static const char *pieces[] = {
+    "int", "in", "if", "else", "elsewhere", "while", "return", "void",
+    "x", "y1", "z", "0", "42", "2147483647", "2147483648",
+    "99999999999999999999", "=", "==", "!", "!=", "<", "<=", ">", ">=",
+    "+", "-", "*", "/", "/*", "*/", "**", "(", ")", "[", "]", "{", "}",
+    ";", ",", " ", "  ", "\t", "\n", "\n\n", "@", "$", "\0"};
+
+#define NPIECES (sizeof(pieces) / sizeof(pieces[0]))
+
+/* MAXTEXT bounds the length of the program */
+#define MAXTEXT 4096
+
+static char text[MAXTEXT + 2];
+static int textLen;
+
+/* addPieces writes n random pieces to buf and returns
+ * the number of bytes written
+ */
+static int addPieces(char *buf, int n)
+{
+  int len = 0;
+  while (n-- > 0)
+  {
+    int i = rand() % NPIECES;
+    int plen = pieces[i][0] == '\0' ? 1 : (int)strlen(pieces[i]);
+    memcpy(buf + len, pieces[i], plen);
+    len += plen;
+  }
+  return len;
+}
+
+/* scanAll scans the whole of src into ts as the
+ * pre-scan would
+ */
+static void scanAll(Source *src, TokenStream *ts)
+{
+  int p = 0, line = 1;
+  TokenType t;
+  do
+  {
+    Span span;
+    int val = 0;
+    t = dfaToken(src, p, &line, &span, &val);
+    if (t == ID)
+      val = internName(src->text + span.pos, span.len);
+    appendToken(ts, t, span, line, val);
+    p = span.pos + span.len;
+  } while (t != ENDFILE);
+}
+
+/* sameTokens reports the first token where a and b
+ * differ and returns FALSE, or returns TRUE
+ */
+static int sameTokens(TokenStream *a, TokenStream *b)
+{
+  int i;
+  for (i = 0; i < a->count && i < b->count; i++)
+    if (a->kind[i] != b->kind[i] || a->span[i].pos != b->span[i].pos ||
+        a->span[i].len != b->span[i].len || a->line[i] != b->line[i] ||
+        a->val[i] != b->val[i])
+    {
+      fprintf(stderr, "token %d: kind %d at %d+%d line %d val %d,"
+                      " rescanned kind %d at %d+%d line %d val %d\n",
+              i, a->kind[i], a->span[i].pos, a->span[i].len, a->line[i],
+              a->val[i], b->kind[i], b->span[i].pos, b->span[i].len,
+              b->line[i], b->val[i]);
+      return FALSE;
+    }
+  if (a->count != b->count)
+  {
+    fprintf(stderr, "%d tokens, rescanned %d\n", a->count, b->count);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned seed = argc > 1 ? (unsigned)atoi(argv[1]) : 1;
+  int edits = argc > 2 ? atoi(argv[2]) : 10000;
+  Source src;
+  TokenStream ts;
+  int e;
+  listing = stderr;
+  srand(seed);
+  memset(&src, 0, sizeof(Source));
+  memset(&ts, 0, sizeof(TokenStream));
+  src.text = text;
+  textLen = addPieces(text, 200);
+  src.len = textLen;
+  scanAll(&src, &ts);
+  for (e = 0; e < edits; e++)
+  {
+    char inserted[64];
+    int pos = rand() % (textLen + 1);
+    int removed = rand() % 4 == 0 ? 0 : rand() % (textLen - pos + 1) % 16;
+    int n = addPieces(inserted, rand() % 4);
+    TokenDelta d;
+    TokenStream full;
+    if (textLen - removed + n > MAXTEXT)
+    { /* keep the program from outgrowing text */
+      n = 0;
+      removed = textLen - pos;
+    }
+    memmove(text + pos + n, text + pos + removed, textLen - pos - removed);
+    memcpy(text + pos, inserted, n);
+    textLen += n - removed;
+    text[textLen] = text[textLen + 1] = '\0';
+    src.len = textLen;
+    relexTokens(&ts, &src, pos, removed, n, &d);
+    applyDelta(&ts, &d);
+    freeDelta(&d);
+    memset(&full, 0, sizeof(TokenStream));
+    scanAll(&src, &full);
+    if (!sameTokens(&ts, &full))
+    {
+      fprintf(stderr, "seed %u, edit %d: replacing %d bytes at %d with %d"
+                      " gives the wrong tokens\n",
+              seed, e, removed, pos, n);
+      return 1;
+    }
+    freeTokens(&full);
+  }
+  freeTokens(&ts);
+  printf("relextest: seed %u, %d edits ok\n", seed, edits);
+  return 0;
+}
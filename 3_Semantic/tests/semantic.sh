@@ -0,0 +1,99 @@
+#!/bin/sh
+# Usage: tests/semantic.sh [COMPILER]
+#
+# Checks test_*.cm and the programs written below with both parsers
+# and compares the errors reported, and the exit status, with those
+# expected: none and 0 for a valid program, the listed errors and 1
+# otherwise. test_1.cm and test_2.cm are valid; the errors of test_3.cm
+# and test_4.cm are those of result_3.txt and result_4.txt, with the
+# column added. COMPILER is a binary built in this directory,
+# cminus_semantic by default.
+#
+# Exits with 1 if any run differs.
+
+cd "$(dirname "$0")/.." || exit 1
+cc=${1:-cminus_semantic}
+
+cases=$(mktemp -d) || exit 1
+trap 'rm -rf "$cases"' EXIT
+
+# valid: arrays passed whole, calls as arguments and operands,
+# sibling blocks declaring the same name
+cat >"$cases/valid.cm" <<'EOF'
+int g[10];
+int sum(int a[], int n)
+{
+  int i; int s;
+  i = 0; s = 0;
+  while (i < n) { s = s + a[i]; i = i + 1; }
+  return s;
+}
+void show(int v) { output(v); }
+void main(void)
+{
+  int x[10]; int k;
+  k = sum(x, 10) + sum(g, g[2]);
+  show(sum(x, k));
+  { int q; q = 1; } { int q; q = 2; }
+  return;
+}
+EOF
+: >"$cases/valid.err"
+
+cat >"$cases/calls.cm" <<'EOF'
+int f(int a[]) { return a[0]; }
+void v(void) { return; }
+void main(void)
+{
+  int x; int y[3];
+  x = f(x);
+  x = f(y, y);
+  y = 1;
+  x = v();
+  x = y[v()];
+  output(y);
+  x = h(1);
+  x = z;
+}
+EOF
+cat >"$cases/calls.err" <<'EOF'
+Error: Invalid function call at line 6, column 7 (name : "f")
+Error: Invalid function call at line 7, column 7 (name : "f")
+Error: Invalid assignment at line 8, column 3
+Error: Invalid assignment at line 9, column 3
+Error: Invalid array indexing at line 10, column 7 (name : "y"). Indices should be integer
+Error: Invalid function call at line 11, column 3 (name : "output")
+Error: Undeclared function "h" is used at line 12, column 7
+Error: Invalid assignment at line 12, column 3
+Error: Undeclared variable "z" is used at line 13, column 7
+Error: Invalid assignment at line 13, column 3
+EOF
+
+cp test_1.cm test_2.cm test_3.cm test_4.cm "$cases"
+: >"$cases/test_1.err"
+: >"$cases/test_2.err"
+cat >"$cases/test_3.err" <<'EOF'
+Error: Invalid function call at line 12, column 12 (name : "x")
+EOF
+cat >"$cases/test_4.err" <<'EOF'
+Error: Invalid array indexing at line 4, column 5 (name : "x"). Indices should be integer
+EOF
+
+status=0
+for f in "$cases"/*.cm; do
+  name=$(basename "$f" .cm)
+  if [ -s "$cases/$name.err" ]; then want=1; else want=0; fi
+  for parser in yacc rd; do
+    ./"$cc" --check-only --parser=$parser "$f" >"$cases/out" 2>&1
+    code=$?
+    grep '^Error' "$cases/out" >"$cases/got"
+    if [ $code -ne $want ] || ! diff "$cases/$name.err" "$cases/got" >"$cases/diff"; then
+      echo "FAIL $name.cm --parser=$parser: exit status $code, expected $want"
+      head -20 "$cases/diff"
+      status=1
+    else
+      echo "ok   $name.cm --parser=$parser"
+    fi
+  done
+done
+exit $status
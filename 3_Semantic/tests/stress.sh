@@ -0,0 +1,86 @@
+#!/bin/sh
+# Usage: tests/stress.sh [COMPILER]
+#
+# Compiles very long and very deeply nested programs with both parsers
+# and checks that each one is scanned, parsed, checked and dumped
+# without the compiler crashing or reporting errors. COMPILER is a
+# binary built in this directory, cminus_semantic by default.
+#
+# The yacc parser keeps its state stack at most YYMAXDEPTH (10000)
+# entries deep, and a nested if or block takes two, so from about
+# 5000 levels on it stops with "memory exhausted". Those cases are
+# expected to fail that way. The recursive-descent parser has no such
+# limit.
+#
+# Exits with 1 if any case does not end as expected.
+
+cd "$(dirname "$0")/.." || exit 1
+cc=${1:-cminus_semantic}
+
+cases=$(mktemp -d) || exit 1
+trap 'rm -rf "$cases"' EXIT
+
+# long: one function of 200000 statements, and 50000 functions
+awk 'BEGIN { print "void main(void)\n{\n  int x;\n  x = 0;"
+             for (i = 0; i < 200000; i++) print "  x = x + 1;"
+             print "}" }' >"$cases/longstmts.cm"
+awk 'BEGIN { for (i = 0; i < 50000; i++)
+               printf "int f%d(int a)\n{\n  return a + 1;\n}\n", i
+             print "void main(void)\n{\n  int x;\n  x = 0;\n  f0(x);\n}" }' \
+    >"$cases/longfuncs.cm"
+# deep: ifs, blocks and parentheses nested N levels deep
+for n in 1000 5000 20000; do
+  awk -v n=$n 'BEGIN { print "void main(void)\n{\n  int x;\n  x = 0;"
+                       for (i = 0; i < n; i++) printf "if (x) "
+                       print "x = 1;\n}" }' >"$cases/deepif$n.cm"
+  awk -v n=$n 'BEGIN { print "void main(void)\n{\n  int x;\n  x = 0;"
+                       for (i = 0; i < n; i++) printf "{ "
+                       printf "x = 1;"
+                       for (i = 0; i < n; i++) printf " }"
+                       print "\n}" }' >"$cases/deepblock$n.cm"
+  awk -v n=$n 'BEGIN { print "void main(void)\n{\n  int x;\n  x = 0;"
+                       printf "  x = "
+                       for (i = 0; i < n; i++) printf "("
+                       printf "x"
+                       for (i = 0; i < n; i++) printf " + 1)"
+                       print ";\n}" }' >"$cases/deepparen$n.cm"
+done
+
+# expected FILE PARSER prints what a run should end in:
+# ok, or the error the parser stops with
+expected() {
+  case "$2:$(basename "$1" .cm)" in
+  yacc:deepif5000 | yacc:deepif20000 | yacc:deepblock5000 | \
+  yacc:deepblock20000 | yacc:deepparen20000)
+    echo "memory exhausted" ;;
+  *)
+    echo ok ;;
+  esac
+}
+
+status=0
+for f in "$cases"/*.cm; do
+  for parser in yacc rd; do
+    for args in "" "--parse-only --tree=json"; do
+      want=$(expected "$f" $parser)
+      ./"$cc" --parser=$parser $args "$f" >"$cases/out" 2>&1
+      code=$?
+      if [ $code -eq 0 ]; then
+        got=ok
+      elif grep -q "memory exhausted" "$cases/out"; then
+        got="memory exhausted"
+      else
+        got="exit status $code"
+      fi
+      name="$(basename "$f") --parser=$parser $args"
+      if [ "$got" = "$want" ]; then
+        echo "ok   $name: $got"
+      else
+        echo "FAIL $name: $got, expected $want"
+        grep -v '^$' "$cases/out" | head -5
+        status=1
+      fi
+    done
+  done
+done
+exit $status
@@ -0,0 +1,59 @@
+#!/bin/sh
+# Usage: tests/tokdiff.sh REFERENCE SCANNER...
+#
+# Lists the tokens of the test_*.cm programs, and of the edge cases
+# written below, with --lex-only --trace-scan, and diffs the listing
+# and exit status of each SCANNER against those of REFERENCE. The
+# binaries are named as built in this directory, e.g.
+#
+#   tests/tokdiff.sh cminus_semantic cminus_dfa
+#
+# Exits with 1 if any listing differs.
+
+cd "$(dirname "$0")/.." || exit 1
+[ $# -ge 2 ] || { sed -n '2,/^$/s/^# \{0,1\}//p' "$0" >&2; exit 2; }
+ref=$1
+shift
+
+cases=$(mktemp -d) || exit 1
+trap 'rm -rf "$cases"' EXIT
+
+# identifiers much longer than any buffer a scanner might keep
+awk 'BEGIN { s = "x"; while (length(s) < 5000) s = s s
+             printf "int %s;\nint y%sq;\n", s, substr(s, 1, 300) }' >"$cases/longid.cm"
+# numbers past the range of an int, and leading zeros
+awk 'BEGIN { s = "9"; while (length(s) < 400) s = s s
+             printf "int a[%s]; x = %s + 2147483647 + 2147483648 + 0007;\n",
+                    substr(s, 1, 50), s }' >"$cases/bignum.cm"
+# comments left open at the end of the file
+printf 'int x; /* never closed\n * more\n int y;\n' >"$cases/unterm.cm"
+printf 'int x; /* ** *' >"$cases/unterm2.cm"
+# NUL bytes in code, in a comment and last in the file
+printf 'int x\0y; /* a \0 b */ z\0\0 = 1;\n\0' >"$cases/nul.cm"
+# operators run together, comments made of stars, odd white space
+printf 'a<=b>=c==d!=e<f>g=h!i/j*/k/**/l/***/m/*x*y**/n\t\r\f\v;' >"$cases/ops.cm"
+# no final newline, and nothing at all
+printf 'int x' >"$cases/noeol.cm"
+: >"$cases/empty.cm"
+
+# tokens FILE BINARY lists the tokens of FILE and the exit status
+tokens() {
+  ./"$2" --lex-only --trace-scan "$1" 2>&1
+  echo "exit $?"
+}
+
+status=0
+for scanner in "$@"; do
+  for f in test_*.cm "$cases"/*.cm; do
+    tokens "$f" "$ref" >"$cases/ref.out"
+    tokens "$f" "$scanner" >"$cases/out"
+    if ! diff "$cases/ref.out" "$cases/out" >"$cases/diff"; then
+      echo "FAIL $scanner $(basename "$f"): tokens differ from $ref"
+      head -20 "$cases/diff"
+      status=1
+    else
+      echo "ok   $scanner $(basename "$f")"
+    fi
+  done
+done
+exit $status
@@ -0,0 +1,102 @@
+#!/bin/sh
+# Usage: tests/treediff.sh [COMPILER]
+#
+# Dumps the syntax trees of test_*.cm, and of the long, deep and
+# broken programs written below, with --parse-only --tree=compact,
+# and diffs the tree, the listing and the exit status of each way of
+# parsing against those of a plain parse with the yacc parser:
+#
+#   rd       --parser=rd, the recursive-descent parser
+#   threadsN --prescan --parse-threads=N, which cuts a program of
+#            more than MINPART (16384) tokens after top-level
+#            declarations into parts parsed on N threads, as it
+#            does longfuncs.cm, err_mid.cm and err_late.cm
+#   stream   --stream -, which parses the program as it is read
+#            from standard input, here a pipe
+#   cold     --cache with no .ast file, which parses the program and
+#            writes its tree to one if it parsed
+#   warm     --cache again, which reads the tree back from it
+#
+# COMPILER is a binary built in this directory, cminus_semantic by
+# default. Exits with 1 if any run differs.
+
+cd "$(dirname "$0")/.." || exit 1
+cc=$(pwd)/${1:-cminus_semantic}
+
+cases=$(mktemp -d) || exit 1
+trap 'rm -rf "$cases"' EXIT
+
+cp test_*.cm "$cases"
+# long: many statements, and many functions
+awk 'BEGIN { print "void main(void)\n{\n  int x;\n  x = 0;"
+             for (i = 0; i < 20000; i++) print "  x = x + 1;"
+             print "}" }' >"$cases/longstmts.cm"
+awk 'BEGIN { for (i = 0; i < 3000; i++)
+               printf "int f%d(int a[], int n)\n{\n  if (n > 0) return a[n - 1];\n  return f%d(a, n + 1);\n}\n", i, i
+             print "void main(void)\n{\n  int x;\n  x = f0(x, 0);\n}" }' \
+    >"$cases/longfuncs.cm"
+# deep: ifs, blocks and parentheses, below the depth the yacc
+# parser gives up at (see tests/stress.sh)
+awk 'BEGIN { print "void main(void)\n{\n  int x;\n  x = 0;"
+             for (i = 0; i < 400; i++) printf "if (x) { while (x) "
+             printf "x = (((x + 1) * 2) - 3);"
+             for (i = 0; i < 400; i++) printf " }"
+             print "\n}" }' >"$cases/deep.cm"
+# syntax errors: early, in the middle and at the end of a long
+# program, at the end of the file, and inside a comment left open;
+# and nothing at all
+printf 'int x;\nvoid main(void) { x = 1 }\n' >"$cases/err_semi.cm"
+printf 'int f(int a) { return a; }}\nint g;\n' >"$cases/err_brace.cm"
+printf 'void main(void) { int x; x = @; }\n' >"$cases/err_token.cm"
+printf 'void main(void) { int x; x = (1 + ' >"$cases/err_eof.cm"
+printf 'int x; /* never closed\nvoid main(void) { }\n' >"$cases/err_comment.cm"
+awk 'NR == 7000 { print "int mid int;" } { print }' "$cases/longfuncs.cm" \
+    >"$cases/err_mid.cm"
+awk '{ print } END { print "int late int;" }' "$cases/longfuncs.cm" \
+    >"$cases/err_late.cm"
+: >"$cases/empty.cm"
+
+# parse INPUT ARGS... prints the exit status, the tree and the
+# listing of a parse with ARGS, INPUT on standard input
+parse() {
+  input=$1
+  shift
+  "$cc" --parse-only --tree=compact "$@" <"$input" >"$cases/tree" 2>"$cases/listing"
+  echo "exit $?"
+  cat "$cases/tree" "$cases/listing"
+}
+
+# run WAY FILE parses FILE the way WAY names
+run() {
+  case $1 in
+  yacc) parse "$2" --parser=yacc "$2" ;;
+  rd) parse "$2" --parser=rd "$2" ;;
+  threads*) parse "$2" --prescan --parse-threads=${1#threads} "$2" ;;
+  stream) cat "$2" | parse /dev/stdin --stream - ;;
+  cold)
+    rm -f "${2%.cm}.ast"
+    parse "$2" --cache "$2" ;;
+  warm)
+    rm -f "${2%.cm}.ast"
+    if parse "$2" --cache "$2" | grep -q '^exit 0$' && [ ! -f "${2%.cm}.ast" ]; then
+      echo "no cache written"
+    fi
+    parse "$2" --cache "$2" ;;
+  esac
+}
+
+status=0
+for f in "$cases"/*.cm; do
+  run yacc "$f" >"$cases/ref.out"
+  for way in rd threads2 threads4 stream cold warm; do
+    run $way "$f" >"$cases/out"
+    if ! diff "$cases/ref.out" "$cases/out" >"$cases/diff"; then
+      echo "FAIL $way $(basename "$f"): tree differs from yacc"
+      head -20 "$cases/diff"
+      status=1
+    else
+      echo "ok   $way $(basename "$f")"
+    fi
+  done
+done
+exit $status
@@ -0,0 +1,122 @@
+/****************************************************/
+/* File: tokens.c                                   */
+/* Pre-scanned token streams for the C-Minus        */
+/* compiler                                         */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "scan.h"
+#include "source.h"
+#include "intern.h"
+#include "tokens.h"
+#include "compile.h"
+#include "trace.h"
+
+/* INITTOKENS is the initial capacity of a stream */
+#define INITTOKENS 4096
+
+/* growStream doubles the capacity of every array
+ * until it holds at least need tokens
+ */
+static void growStream(TokenStream *ts, int need)
+{
+  int cap = ts->cap ? ts->cap * 2 : INITTOKENS;
+  while (cap < need)
+    cap *= 2;
+  TokenType *kind = realloc(ts->kind, cap * sizeof(TokenType));
+  Span *span = realloc(ts->span, cap * sizeof(Span));
+  int *line = realloc(ts->line, cap * sizeof(int));
+  int *val = realloc(ts->val, cap * sizeof(int));
+  if (kind != NULL)
+    ts->kind = kind;
+  if (span != NULL)
+    ts->span = span;
+  if (line != NULL)
+    ts->line = line;
+  if (val != NULL)
+    ts->val = val;
+  if (kind == NULL || span == NULL || line == NULL || val == NULL)
+  {
+    fprintf(listing, "Out of memory error at line %d\n", lineno);
+    exit(1);
+  }
+  ts->cap = cap;
+}
+
+void appendToken(TokenStream *ts, TokenType kind, Span span, int line, int val)
+{
+  int i = ts->count;
+  if (i == ts->cap)
+    growStream(ts, i + 1);
+  ts->kind[i] = kind;
+  ts->span[i] = span;
+  ts->line[i] = line;
+  ts->val[i] = val;
+  ts->count++;
+}
+
+void reserveTokens(TokenStream *ts, int count)
+{
+  if (count > ts->cap)
+    growStream(ts, count);
+}
+
+void scanTokens(TokenStream *ts)
+{
+  TokenType t;
+  do
+  {
+    int val = 0;
+    t = getToken();
+    if (t == ID)
+      val = tokenAtom;
+    else if (t == NUM)
+      val = tokenVal;
+    appendToken(ts, t, tokenSpan, lineno, val);
+  } while (t != ENDFILE);
+  ts->next = 0;
+}
+
+TokenType streamToken(TokenStream *ts, Compilation *cc)
+{
+  int i = ts->next;
+  if (i >= ts->count)
+    return ENDFILE;
+  if (ts->kind[i] != ENDFILE)
+    ts->next++;
+  cc->lineno = ts->line[i];
+  cc->tokenSpan = ts->span[i];
+  if (ts->kind[i] == ID)
+    cc->tokenAtom = ts->val[i];
+  else if (ts->kind[i] == NUM)
+    cc->tokenVal = ts->val[i];
+  cc->token = ts->kind[i];
+  return ts->kind[i];
+}
+
+void traceTokens(TokenStream *ts)
+{
+  int i;
+  for (i = 0; i < ts->count; i++)
+    if (TraceBinary)
+      traceToken(ts->kind[i], ts->span[i], ts->line[i]);
+    else
+    {
+      fprintf(listing, "\t%d: ", ts->line[i]);
+      printToken(ts->kind[i], sourceText + ts->span[i].pos, ts->span[i].len);
+    }
+}
+
+void freeTokens(TokenStream *ts)
+{
+  free(ts->kind);
+  free(ts->span);
+  free(ts->line);
+  free(ts->val);
+  ts->kind = NULL;
+  ts->span = NULL;
+  ts->line = NULL;
+  ts->val = NULL;
+  ts->count = ts->cap = ts->next = 0;
+}
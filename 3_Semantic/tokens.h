@@ -0,0 +1,55 @@
+/****************************************************/
+/* File: tokens.h                                   */
+/* Pre-scanned token streams for the C-Minus        */
+/* compiler                                         */
+/****************************************************/
+
+#ifndef _TOKENS_H_
+#define _TOKENS_H_
+
+/* A TokenStream holds a whole scanned program as
+ * parallel arrays, one entry per token, ending with
+ * an ENDFILE token. val is the atom of an ID and the
+ * value of a NUM.
+ */
+typedef struct
+{
+  int count;      /* number of tokens */
+  int cap;        /* allocated length of the arrays */
+  int next;       /* index of the next token to parse */
+  TokenType *kind;
+  Span *span;
+  int *line;
+  int *val;
+} TokenStream;
+
+/* Procedure scanTokens runs the scanner over the
+ * whole source program, appending every token to ts
+ */
+void scanTokens(TokenStream *ts);
+
+/* Procedure reserveTokens makes room in ts for
+ * count tokens in all
+ */
+void reserveTokens(TokenStream *ts, int count);
+
+/* Procedure appendToken adds one token to ts */
+void appendToken(TokenStream *ts, TokenType kind, Span span, int line, int val);
+
+/* Function streamToken returns the next token of ts
+ * to the parser of compilation cc, setting its line,
+ * lexeme, span and atom as scanToken would
+ */
+struct compilation;
+TokenType streamToken(TokenStream *ts, struct compilation *cc);
+
+/* Procedure traceTokens prints ts to the listing
+ * file in the format getToken uses for TraceScan,
+ * or records it in the binary trace if TraceBinary
+ */
+void traceTokens(TokenStream *ts);
+
+/* Procedure freeTokens releases the arrays of ts */
+void freeTokens(TokenStream *ts);
+
+#endif
@@ -0,0 +1,115 @@
+/****************************************************/
+/* File: trace.c                                    */
+/* Binary token traces for the C-Minus compiler     */
+/* A token costs a few bytes copied into a buffer   */
+/* instead of a formatted fprintf, so TraceScan can */
+/* stay on for real workloads; tracedump prints the */
+/* trace in the usual text form afterwards.         */
+/****************************************************/
+
+#include "globals.h"
+#include "trace.h"
+#include "util.h"
+
+/* size of the record buffer */
+#define TRACEBUF (1 << 16)
+
+/* a record takes at most four five-byte numbers */
+#define MAXRECORD 20
+
+static FILE *traceFile = NULL;
+static char *traceName = NULL;
+static int traceOk = TRUE; /* FALSE once a write has failed */
+static unsigned char traceBuf[TRACEBUF];
+static int traceLen = 0;
+static int prevEnd = 0;  /* offset just past the last token */
+static int prevLine = 1; /* line of the last token */
+
+/* traceFailed reports the first failed write; the
+ * tokens after it are no longer recorded
+ */
+static void traceFailed(void)
+{
+  if (traceOk)
+    fprintf(listing, "Unable to write %s\n", traceName);
+  traceOk = FALSE;
+}
+
+/* flushTrace writes the buffer out */
+static void flushTrace(void)
+{
+  if (traceLen > 0 && traceOk &&
+      fwrite(traceBuf, 1, traceLen, traceFile) != (size_t)traceLen)
+    traceFailed();
+  traceLen = 0;
+}
+
+/* putNumber appends n to the buffer as LEB128 */
+static void putNumber(unsigned n)
+{
+  while (n >= 0x80)
+  {
+    traceBuf[traceLen++] = (unsigned char)(n | 0x80);
+    n >>= 7;
+  }
+  traceBuf[traceLen++] = (unsigned char)n;
+}
+
+/* zigzag maps small signed numbers to small
+ * unsigned ones: 0, -1, 1, -2, ... to 0, 1, 2, 3, ...
+ */
+static unsigned zigzag(int n)
+{
+  return ((unsigned)n << 1) ^ (unsigned)(n >> 31);
+}
+
+int openTrace(const char *name)
+{
+  traceFile = fopen(name, "wb");
+  if (traceFile == NULL)
+    return FALSE;
+  traceName = copyString((char *)name);
+  traceOk = TRUE;
+  if (fwrite(TRACEMAGIC, 1, strlen(TRACEMAGIC), traceFile) !=
+      strlen(TRACEMAGIC))
+    traceFailed();
+  traceLen = 0;
+  prevEnd = 0;
+  prevLine = 1;
+  return TRUE;
+}
+
+void traceToken(TokenType kind, Span span, int line)
+{
+  if (traceFile == NULL || !traceOk)
+    return;
+  if (traceLen > TRACEBUF - MAXRECORD)
+    flushTrace();
+  putNumber((unsigned)kind);
+  putNumber(zigzag(span.pos - prevEnd));
+  putNumber((unsigned)span.len);
+  putNumber(zigzag(line - prevLine));
+  prevEnd = span.pos + span.len;
+  prevLine = line;
+}
+
+int closeTrace(void)
+{
+  int ok;
+  if (traceFile == NULL)
+    return TRUE;
+  flushTrace();
+  if (fflush(traceFile) != 0 || ferror(traceFile))
+    traceFailed();
+  if (fclose(traceFile) != 0)
+    traceFailed();
+  traceFile = NULL;
+  /* a trace cut short would be read as a shorter program */
+  if (!traceOk)
+    remove(traceName);
+  free(traceName);
+  traceName = NULL;
+  ok = traceOk;
+  traceOk = TRUE;
+  return ok;
+}
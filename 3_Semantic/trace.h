@@ -0,0 +1,38 @@
+/****************************************************/
+/* File: trace.h                                    */
+/* Binary token traces for the C-Minus compiler     */
+/****************************************************/
+
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+/* A trace file starts with the eight bytes of
+ * TRACEMAGIC. Each token then takes four unsigned
+ * LEB128 numbers: its kind, its offset from the end
+ * of the token before it, its length, and its line
+ * less the line of the token before it, the offset
+ * and the line in zigzag form since ENDFILE may step
+ * back. Lexemes are not recorded; tracedump reads
+ * them out of the source program instead.
+ */
+#define TRACEMAGIC "CMTRACE1"
+
+/* Function openTrace starts a binary trace in the
+ * file name. Returns FALSE if it cannot be created.
+ */
+int openTrace(const char *name);
+
+/* Procedure traceToken records one token in the
+ * trace. Records collect in a large buffer that is
+ * written out only when it fills up.
+ */
+void traceToken(TokenType kind, Span span, int line);
+
+/* Function closeTrace writes out what is left of
+ * the buffer and closes the trace file. If any write
+ * failed, the failure has been reported on listing,
+ * the file is removed and closeTrace returns FALSE.
+ */
+int closeTrace(void);
+
+#endif
@@ -0,0 +1,104 @@
+/****************************************************/
+/* File: tracedump.c                                */
+/* Prints a binary token trace (see trace.h) in the */
+/* text form TraceScan writes to the listing        */
+/* usage: tracedump <trace> <source>                */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "source.h"
+#include "trace.h"
+
+/* globals the shared modules expect */
+int lineno = 0;
+FILE *listing;
+int MapSource = TRUE;
+
+/* getNumber reads one LEB128 number from f into *n.
+ * Returns 1, 0 if the trace ends before the number,
+ * or -1 if it ends inside it or the number is too
+ * long to be one trace.c wrote.
+ */
+static int getNumber(FILE *f, unsigned *n)
+{
+  int c, shift = 0;
+  *n = 0;
+  do
+  {
+    if ((c = getc(f)) == EOF || shift > 28)
+      return shift == 0 && c == EOF ? 0 : -1;
+    *n |= (unsigned)(c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  return 1;
+}
+
+/* unzigzag undoes the zigzag form of trace.c */
+static int unzigzag(unsigned n)
+{
+  return (int)(n >> 1) ^ -(int)(n & 1);
+}
+
+int main(int argc, char *argv[])
+{
+  FILE *trace, *file;
+  Source src;
+  char magic[sizeof(TRACEMAGIC) - 1];
+  int end = 0, line = 1, got;
+  unsigned kind, off, len, dline;
+  if (argc != 3)
+  {
+    fprintf(stderr, "usage: %s <trace> <source>\n", argv[0]);
+    exit(1);
+  }
+  listing = stdout;
+  trace = fopen(argv[1], "rb");
+  if (trace == NULL)
+  {
+    fprintf(stderr, "File %s not found\n", argv[1]);
+    exit(1);
+  }
+  if (fread(magic, 1, sizeof(magic), trace) != sizeof(magic) ||
+      memcmp(magic, TRACEMAGIC, sizeof(magic)) != 0)
+  {
+    fprintf(stderr, "%s is not a token trace\n", argv[1]);
+    exit(1);
+  }
+  file = fopen(argv[2], "r");
+  if (file == NULL || !openSource(&src, file))
+  {
+    fprintf(stderr, "Unable to read %s\n", argv[2]);
+    exit(1);
+  }
+  while ((got = getNumber(trace, &kind)) > 0)
+  {
+    int pos;
+    if (getNumber(trace, &off) <= 0 || getNumber(trace, &len) <= 0 ||
+        getNumber(trace, &dline) <= 0)
+    {
+      got = -1;
+      break;
+    }
+    pos = end + unzigzag(off);
+    line += unzigzag(dline);
+    end = pos + (int)len;
+    if (pos < 0 || end > src.len)
+    {
+      fprintf(stderr, "%s does not match %s\n", argv[1], argv[2]);
+      exit(1);
+    }
+    fprintf(listing, "\t%d: ", line);
+    fprintToken(listing, (TokenType)kind, src.text + pos, (int)len);
+  }
+  /* a token half written is the end of a trace cut short */
+  if (got < 0 || ferror(trace))
+  {
+    fprintf(stderr, "%s is cut short\n", argv[1]);
+    exit(1);
+  }
+  closeSource(&src);
+  fclose(file);
+  fclose(trace);
+  return 0;
+}
@@ -0,0 +1,98 @@
+/****************************************************/
+/* File: traverse.c                                 */
+/* Syntax tree traversal for the C-Minus compiler   */
+/* The walk keeps an explicit stack with a frame    */
+/* for each open node, so its depth is the nesting  */
+/* depth of the tree; a node's sibling replaces the */
+/* node rather than going on top of it.             */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "traverse.h"
+
+/* a node whose children are being visited */
+typedef struct
+{
+  NodeId id;
+  int child; /* the next child to visit */
+} Frame;
+
+typedef struct
+{
+  Frame *frame;
+  int count, cap;
+} Stack;
+
+int opensScope(TreeNode *t)
+{
+  return (t->nodekind == StmtK && t->kind.stmt == CompK) ||
+         (t->nodekind == DclrK && t->kind.dclr == FuncK);
+}
+
+/* enter calls the hooks that come before the
+ * children of node id and pushes its frame
+ */
+static void enter(Stack *s, NodeId id, const Visitor *v)
+{
+  TreeNode *t = NODE(id);
+  if (s->count == s->cap)
+  {
+    int cap = s->cap == 0 ? 64 : 2 * s->cap;
+    Frame *frame = realloc(s->frame, cap * sizeof(Frame));
+    if (frame == NULL)
+    {
+      fprintf(listing, "Out of memory traversing the syntax tree\n");
+      exit(1);
+    }
+    s->frame = frame;
+    s->cap = cap;
+  }
+  s->frame[s->count].id = id;
+  s->frame[s->count].child = 0;
+  s->count++;
+  if (v->preProc != NULL)
+    v->preProc(t);
+  if (v->enterScope != NULL && opensScope(t))
+    v->enterScope(t);
+}
+
+static void walk(NodeId id, const Visitor *v, int siblings)
+{
+  Stack s = {NULL, 0, 0};
+  if (id == NONODE)
+    return;
+  enter(&s, id, v);
+  while (s.count > 0)
+  {
+    Frame *f = &s.frame[s.count - 1];
+    TreeNode *t = NODE(f->id);
+    if (f->child < MAXCHILDREN)
+    {
+      NodeId c = t->child[f->child++];
+      if (c != NONODE)
+        enter(&s, c, v);
+      continue;
+    }
+    s.count--;
+    if (v->exitScope != NULL && opensScope(t))
+      v->exitScope(t);
+    if (v->postProc != NULL)
+      v->postProc(t);
+    /* the root's siblings only if asked for, but
+     * always those of the nodes below it */
+    if (t->sibling != NONODE && (siblings || s.count > 0))
+      enter(&s, t->sibling, v);
+  }
+  free(s.frame);
+}
+
+void traverse(NodeId id, const Visitor *v)
+{
+  walk(id, v, TRUE);
+}
+
+void traverseNode(NodeId id, const Visitor *v)
+{
+  walk(id, v, FALSE);
+}
@@ -0,0 +1,44 @@
+/****************************************************/
+/* File: traverse.h                                 */
+/* Syntax tree traversal for the C-Minus compiler   */
+/****************************************************/
+
+#ifndef _TRAVERSE_H_
+#define _TRAVERSE_H_
+
+/* A Visitor holds the procedures a traversal calls
+ * at each node; any of them may be NULL. preProc is
+ * called before the node's children and postProc
+ * after them. A node that opens a scope gets
+ * enterScope after preProc and exitScope before
+ * postProc, so the scope is open exactly while its
+ * children are visited.
+ */
+typedef struct
+{
+  void (*preProc)(TreeNode *);
+  void (*postProc)(TreeNode *);
+  void (*enterScope)(TreeNode *);
+  void (*exitScope)(TreeNode *);
+} Visitor;
+
+/* Function opensScope returns TRUE if node t opens
+ * a scope: a function declaration or a compound
+ * statement
+ */
+int opensScope(TreeNode *t);
+
+/* Procedure traverse visits the tree at id and the
+ * siblings that follow it, depth first, children
+ * in order. It keeps its own stack on the heap, so
+ * neither long statement lists nor deep nesting can
+ * overflow the C stack.
+ */
+void traverse(NodeId id, const Visitor *v);
+
+/* Procedure traverseNode is traverse for the tree at
+ * id alone, leaving out its siblings
+ */
+void traverseNode(NodeId id, const Visitor *v);
+
+#endif
@@ -0,0 +1,495 @@
+/****************************************************/
+/* File: treedump.c                                 */
+/* Syntax tree dumps for the C-Minus compiler       */
+/* The tree is walked with an explicit stack, as in */
+/* traverse.c, and the dump is built up in one big  */
+/* buffer written out with fwrite, rather than by   */
+/* an fprintf call for every piece of every line.   */
+/****************************************************/
+
+#include "globals.h"
+#include "util.h"
+#include "intern.h"
+#include "source.h"
+#include "treedump.h"
+
+/* DUMPBUF is the size of the output buffer */
+#define DUMPBUF (1 << 18)
+
+typedef struct
+{
+  FILE *f;
+  char *buf;
+  int len;
+  int line; /* the line of the last node located */
+} Out;
+
+/* a node whose children are being dumped */
+typedef struct
+{
+  NodeId id;
+  int child; /* the next child to dump */
+  int slot;  /* the child of its parent it is in */
+} Frame;
+
+typedef struct
+{
+  Frame *frame;
+  int count, cap;
+} Stack;
+
+static void flush(Out *o)
+{
+  fwrite(o->buf, 1, o->len, o->f);
+  o->len = 0;
+}
+
+static void putChars(Out *o, const char *s, int n)
+{
+  if (o->len + n > DUMPBUF)
+  {
+    flush(o);
+    if (n > DUMPBUF)
+    {
+      fwrite(s, 1, n, o->f);
+      return;
+    }
+  }
+  memcpy(o->buf + o->len, s, n);
+  o->len += n;
+}
+
+static void putStr(Out *o, const char *s)
+{
+  putChars(o, s, strlen(s));
+}
+
+static void putInt(Out *o, int v)
+{
+  char digits[12];
+  int n = sizeof(digits);
+  unsigned u = v < 0 ? -(unsigned)v : (unsigned)v;
+  do
+  {
+    digits[--n] = '0' + u % 10;
+    u /= 10;
+  } while (u > 0);
+  if (v < 0)
+    digits[--n] = '-';
+  putChars(o, digits + n, sizeof(digits) - n);
+}
+
+static void putSpaces(Out *o, int n)
+{
+  static const char spaces[] = "                                ";
+  while (n > 0)
+  {
+    int k = n < (int)sizeof(spaces) - 1 ? n : (int)sizeof(spaces) - 1;
+    putChars(o, spaces, k);
+    n -= k;
+  }
+}
+
+/* putPlace writes the line and column of node t,
+ * separated by sep; the nodes come roughly in
+ * source order, so each is looked for near the
+ * last
+ */
+static void putPlace(Out *o, TreeNode *t, const char *sep)
+{
+  o->line = lineNear(curSource, t->pos, o->line);
+  putInt(o, o->line);
+  putStr(o, sep);
+  putInt(o, t->pos - curSource->lineStarts[o->line - 1] + 1);
+}
+
+/* putName writes the name held by node t as the
+ * listing has always printed it
+ */
+static void putName(Out *o, TreeNode *t)
+{
+  char *name = nodeName(t);
+  putStr(o, name != NULL ? name : "(null)");
+}
+
+/* putJsonString writes s as a JSON string */
+static void putJsonString(Out *o, const char *s)
+{
+  putChars(o, "\"", 1);
+  for (; *s != '\0'; s++)
+  {
+    unsigned char c = *s;
+    if (c == '"' || c == '\\')
+    {
+      putChars(o, "\\", 1);
+      putChars(o, s, 1);
+    }
+    else if (c < 0x20)
+    {
+      char esc[7];
+      snprintf(esc, sizeof(esc), "\\u%04x", c);
+      putChars(o, esc, 6);
+    }
+    else
+      putChars(o, s, 1);
+  }
+  putChars(o, "\"", 1);
+}
+
+/* opText returns the text of operator op, or NULL
+ * if it is not one
+ */
+static const char *opText(TokenType op)
+{
+  switch (op)
+  {
+  case ASSIGN:
+    return "=";
+  case EQ:
+    return "==";
+  case NE:
+    return "!=";
+  case LT:
+    return "<";
+  case LE:
+    return "<=";
+  case GT:
+    return ">";
+  case GE:
+    return ">=";
+  case PLUS:
+    return "+";
+  case MINUS:
+    return "-";
+  case TIMES:
+    return "*";
+  case OVER:
+    return "/";
+  default:
+    return NULL;
+  }
+}
+
+static const char *stmtKinds[] = {"IfK", "ElseK", "WhileK", "ReturnK",
+                                  "NonReturnK", "CompK", "AssignK"};
+static const char *expKinds[] = {"OpK", "ConstK", "IdK", "ArrEK", "CallK"};
+static const char *dclrKinds[] = {"VarK", "ArrK", "FuncK", "TypeK"};
+static const char *paramKinds[] = {"NArrK", "ArrPK", "NullK"};
+static const char *types[] = {"void", "int", "int[]", "void[]", "null"};
+
+#define NAMED(kinds, k) \
+  ((k) < sizeof(kinds) / sizeof(kinds[0]) ? kinds[k] : "?")
+
+/* kindName returns the name of the kind of node t */
+static const char *kindName(TreeNode *t)
+{
+  switch (t->nodekind)
+  {
+  case StmtK:
+    return NAMED(stmtKinds, t->kind.stmt);
+  case ExpK:
+    return NAMED(expKinds, t->kind.exp);
+  case DclrK:
+    return NAMED(dclrKinds, t->kind.dclr);
+  case ParamK:
+    return NAMED(paramKinds, t->kind.prm);
+  default:
+    return "?";
+  }
+}
+
+/* hasType returns TRUE if the dump gives the type
+ * of node t
+ */
+static int hasType(TreeNode *t)
+{
+  return t->nodekind == DclrK ||
+         (t->nodekind == ParamK && t->kind.prm != NullK);
+}
+
+/* textLine writes the line of the indented listing
+ * for node t, which is at the given depth
+ */
+static void textLine(Out *o, TreeNode *t, int depth)
+{
+  putSpaces(o, 2 * (depth + 1));
+  if (t->nodekind == StmtK)
+  {
+    switch (t->kind.stmt)
+    {
+    case IfK:
+      putStr(o, "If Statement:\n");
+      break;
+    case ElseK:
+      putStr(o, "If-Else Statement:\n");
+      break;
+    case WhileK:
+      putStr(o, "While Statement:\n");
+      break;
+    case NonReturnK:
+      putStr(o, "Non-value Return Statement\n");
+      break;
+    case ReturnK:
+      putStr(o, "Return Statement:\n");
+      break;
+    case CompK:
+      putStr(o, "Compound Statement:\n");
+      break;
+    case AssignK:
+      putStr(o, "Assign:\n");
+      break;
+    default:
+      putStr(o, "Unknown ExpNode kind\n");
+      break;
+    }
+  }
+  else if (t->nodekind == ExpK)
+  {
+    switch (t->kind.exp)
+    {
+    case OpK:
+    {
+      const char *op = opText(t->attr.op);
+      putStr(o, "Op: ");
+      if (op != NULL)
+        putStr(o, op);
+      else
+      {
+        putStr(o, "Unknown token: ");
+        putInt(o, t->attr.op);
+      }
+      putStr(o, "\n");
+      break;
+    }
+    case ConstK:
+      putStr(o, "Const: ");
+      putInt(o, t->attr.val);
+      putStr(o, "\n");
+      break;
+    case IdK:
+    case ArrEK:
+      putStr(o, "Variable: name = ");
+      putName(o, t);
+      putStr(o, "\n");
+      break;
+    case CallK:
+      putStr(o, "Call: function name = ");
+      putName(o, t);
+      putStr(o, "\n");
+      break;
+    default:
+      putStr(o, "Unknown ExpNode kind\n");
+      break;
+    }
+  }
+  else if (t->nodekind == DclrK || t->nodekind == ParamK)
+  {
+    /* the listing gives the element type of arrays,
+     * followed by [] */
+    const char *type;
+    if (t->type == Void || t->type == VoidArr)
+      type = "void";
+    else if (t->type == Integer || t->type == IntArr)
+      type = "int";
+    else if (t->type == Null)
+      type = "null";
+    else
+    {
+      putStr(o, "Unknown ExpType\n");
+      type = "?";
+    }
+    if (t->nodekind == ParamK && t->kind.prm == NullK)
+      putStr(o, "Void Parameter\n");
+    else if (t->nodekind == ParamK && t->kind.prm != NArrK && t->kind.prm != ArrPK)
+      putStr(o, "Unknown ParamNode kind\n");
+    else if (t->nodekind == DclrK && t->kind.dclr == TypeK)
+      putStr(o, "Type Declaration: Don't Print\n");
+    else if (t->nodekind == DclrK && t->kind.dclr > TypeK)
+      putStr(o, "Unknown DclrNode kind\n");
+    else
+    {
+      if (t->nodekind == ParamK)
+        putStr(o, "Parameter: name = ");
+      else if (t->kind.dclr == FuncK)
+        putStr(o, "Function Declaration: name = ");
+      else
+        putStr(o, "Variable Declaration: name = ");
+      putName(o, t);
+      putStr(o, t->kind.dclr == FuncK && t->nodekind == DclrK ? ", return type = " : ", type = ");
+      putStr(o, type);
+      /* ArrK and ArrPK are both 1 */
+      putStr(o, t->kind.dclr == ArrK ? "[]\n" : "\n");
+    }
+  }
+  else
+    putStr(o, "Unknown node kind\n");
+}
+
+/* compactLine writes the line of the compact dump
+ * for node t
+ */
+static void compactLine(Out *o, TreeNode *t, int depth, int slot)
+{
+  Atom name = nodeAtom(t);
+  putInt(o, depth);
+  putStr(o, " ");
+  putInt(o, slot);
+  putStr(o, " ");
+  putStr(o, kindName(t));
+  putStr(o, " ");
+  putPlace(o, t, ":");
+  if (name != NOATOM)
+  {
+    putStr(o, " ");
+    putStr(o, atomName(name));
+  }
+  else if (t->nodekind == ExpK && t->kind.exp == OpK)
+  {
+    const char *op = opText(t->attr.op);
+    putStr(o, " ");
+    putStr(o, op != NULL ? op : "?");
+  }
+  else if (t->nodekind == ExpK && t->kind.exp == ConstK)
+  {
+    putStr(o, " ");
+    putInt(o, t->attr.val);
+  }
+  if (hasType(t))
+  {
+    putStr(o, " ");
+    putStr(o, NAMED(types, t->type));
+  }
+  putStr(o, "\n");
+}
+
+/* childLists returns the number of child lists the
+ * JSON dump gives for node t
+ */
+static int childLists(TreeNode *t)
+{
+  int n = MAXCHILDREN;
+  while (n > 0 && t->child[n - 1] == NONODE)
+    n--;
+  return n;
+}
+
+/* jsonHead writes the JSON object for node t up to
+ * its child lists
+ */
+static void jsonHead(Out *o, TreeNode *t)
+{
+  Atom name = nodeAtom(t);
+  putStr(o, "{\"kind\":\"");
+  putStr(o, kindName(t));
+  putStr(o, "\",\"line\":");
+  putPlace(o, t, ",\"column\":");
+  if (name != NOATOM)
+  {
+    putStr(o, ",\"name\":");
+    putJsonString(o, atomName(name));
+  }
+  else if (t->nodekind == ExpK && t->kind.exp == OpK)
+  {
+    const char *op = opText(t->attr.op);
+    putStr(o, ",\"op\":");
+    putJsonString(o, op != NULL ? op : "?");
+  }
+  else if (t->nodekind == ExpK && t->kind.exp == ConstK)
+  {
+    putStr(o, ",\"value\":");
+    putInt(o, t->attr.val);
+  }
+  if (hasType(t))
+  {
+    putStr(o, ",\"type\":\"");
+    putStr(o, NAMED(types, t->type));
+    putStr(o, "\"");
+  }
+  if (childLists(t) > 0)
+    putStr(o, ",\"child\":[");
+}
+
+/* enter writes what comes before the children of
+ * node id, in the given slot of its parent, and
+ * pushes its frame
+ */
+static void enter(Out *o, Stack *s, NodeId id, int slot, DumpFormat format)
+{
+  TreeNode *t = NODE(id);
+  int depth = s->count;
+  if (s->count == s->cap)
+  {
+    int cap = s->cap == 0 ? 64 : 2 * s->cap;
+    Frame *frame = realloc(s->frame, cap * sizeof(Frame));
+    if (frame == NULL)
+    {
+      fprintf(listing, "Out of memory dumping the syntax tree\n");
+      exit(1);
+    }
+    s->frame = frame;
+    s->cap = cap;
+  }
+  s->frame[s->count].id = id;
+  s->frame[s->count].child = 0;
+  s->frame[s->count].slot = slot;
+  s->count++;
+  if (format == TextDump)
+    textLine(o, t, depth);
+  else if (format == CompactDump)
+    compactLine(o, t, depth, slot);
+  else
+    jsonHead(o, t);
+}
+
+void dumpTree(FILE *out, NodeId id, DumpFormat format)
+{
+  Out o;
+  Stack s = {NULL, 0, 0};
+  int json = format == JsonDump;
+  o.f = out;
+  o.len = 0;
+  o.line = 1;
+  o.buf = malloc(DUMPBUF);
+  if (o.buf == NULL)
+  {
+    fprintf(listing, "Out of memory dumping the syntax tree\n");
+    return;
+  }
+  if (json)
+    putStr(&o, "[\n");
+  if (id != NONODE)
+    enter(&o, &s, id, 0, format);
+  while (s.count > 0)
+  {
+    Frame *f = &s.frame[s.count - 1];
+    TreeNode *t = NODE(f->id);
+    int slot = f->slot;
+    if (f->child < (json ? childLists(t) : MAXCHILDREN))
+    {
+      int i = f->child++;
+      if (json)
+        putStr(&o, i > 0 ? ",[" : "[");
+      if (t->child[i] != NONODE)
+        enter(&o, &s, t->child[i], i, format);
+      else if (json)
+        putStr(&o, "]");
+      continue;
+    }
+    s.count--;
+    if (json)
+      putStr(&o, f->child > 0 ? "]}" : "}");
+    if (t->sibling != NONODE)
+    {
+      if (json)
+        putStr(&o, s.count > 0 ? "," : ",\n");
+      enter(&o, &s, t->sibling, slot, format);
+    }
+    else if (json && s.count > 0)
+      putStr(&o, "]"); /* the end of the parent's list */
+  }
+  if (json)
+    putStr(&o, "\n]\n");
+  flush(&o);
+  free(o.buf);
+  free(s.frame);
+}
@@ -0,0 +1,48 @@
+/****************************************************/
+/* File: treedump.h                                 */
+/* Syntax tree dumps for the C-Minus compiler       */
+/****************************************************/
+
+#ifndef _TREEDUMP_H_
+#define _TREEDUMP_H_
+
+/* the formats a syntax tree can be dumped in:
+ *
+ * TextDump is the indented listing TraceParse has
+ * always printed.
+ *
+ * CompactDump gives one line per node, in preorder:
+ *   depth slot kind line:column [attr] [type]
+ * depth is 0 for the top-level declarations; slot
+ * is the child of its parent the node is in (or in
+ * the sibling list of). kind is the name of the
+ * node's kind, such as FuncK or OpK. attr is the
+ * name, the operator or the value, if the node has
+ * one, and type is given for declarations and
+ * parameters only, e.g.
+ *   2 0 ArrK 3:5 x int[]
+ *
+ * JsonDump gives an array of the top-level
+ * declarations, each node an object with members
+ * kind, line, column, then name, op or value and
+ * type as in CompactDump, then child: an array of
+ * the node's child lists, up to the last one that
+ * is not empty.
+ */
+typedef enum
+{
+  TextDump,
+  CompactDump,
+  JsonDump
+} DumpFormat;
+
+/* Procedure dumpTree writes the syntax tree at id,
+ * with the siblings that follow it, to file out in
+ * the given format. It walks the tree with a stack
+ * of its own and writes through a large buffer, so
+ * trees of millions of nodes, however deep, are
+ * cheap to dump.
+ */
+void dumpTree(FILE *out, NodeId id, DumpFormat format);
+
+#endif
@@ -8,202 +8,216 @@
 
 #include "globals.h"
 #include "util.h"
+#include "source.h"
+#include "intern.h"
 #include <string.h>
-/* Procedure printToken prints a token
- * and its lexeme to the listing file
+/* Procedure fprintToken prints a token and its
+ * lexeme, the len bytes at text, to file out
  */
-void printToken(TokenType token, const char *tokenString)
+void fprintToken(FILE *out, TokenType token, const char *text, int len)
 {
   switch (token)
   {
   case IF:
-    fprintf(listing, "reserved word: if\n");
+    fprintf(out, "reserved word: if\n");
     break;
   // case THEN:
   case ELSE:
-    fprintf(listing, "reserved word: else\n");
+    fprintf(out, "reserved word: else\n");
     break;
   case WHILE:
-    fprintf(listing, "reserved word: while\n");
+    fprintf(out, "reserved word: while\n");
     break;
   case RETURN:
-    fprintf(listing, "reserved word: return\n");
+    fprintf(out, "reserved word: return\n");
     break;
   case INT:
-    fprintf(listing, "reserved word: int\n");
+    fprintf(out, "reserved word: int\n");
     break;
   case VOID:
-    fprintf(listing, "reserved word: void\n");
+    fprintf(out, "reserved word: void\n");
     break;
     // case END:
     // case REPEAT:
     // case UNTIL:
     // case READ:
     // case WRITE:
-    /*fprintf(listing,
+    /*fprintf(out,
        "reserved word: %s\n",tokenString);
     break;*/
     //,NE,,LE,GT,GE,,,,,,,LBRACE,RBRACE,LCURLY,RCULRY,,COMMA
   case ASSIGN:
-    fprintf(listing, "=\n");
+    fprintf(out, "=\n");
     break;
   case EQ:
-    fprintf(listing, "==\n");
+    fprintf(out, "==\n");
     break;
   case NE:
-    fprintf(listing, "!=\n");
+    fprintf(out, "!=\n");
     break;
   case LT:
-    fprintf(listing, "<\n");
+    fprintf(out, "<\n");
     break;
   case LE:
-    fprintf(listing, "<=\n");
+    fprintf(out, "<=\n");
     break;
   case GT:
-    fprintf(listing, ">\n");
+    fprintf(out, ">\n");
     break;
   case GE:
-    fprintf(listing, ">=\n");
+    fprintf(out, ">=\n");
     break;
   case PLUS:
-    fprintf(listing, "+\n");
+    fprintf(out, "+\n");
     break;
   case MINUS:
-    fprintf(listing, "-\n");
+    fprintf(out, "-\n");
     break;
   case TIMES:
-    fprintf(listing, "*\n");
+    fprintf(out, "*\n");
     break;
   case OVER:
-    fprintf(listing, "/\n");
+    fprintf(out, "/\n");
     break;
   case LPAREN:
-    fprintf(listing, "(\n");
+    fprintf(out, "(\n");
     break;
   case RPAREN:
-    fprintf(listing, ")\n");
+    fprintf(out, ")\n");
     break;
   case LBRACE:
-    fprintf(listing, "[\n");
+    fprintf(out, "[\n");
     break;
   case RBRACE:
-    fprintf(listing, "]\n");
+    fprintf(out, "]\n");
     break;
   case LCURLY:
-    fprintf(listing, "{\n");
+    fprintf(out, "{\n");
     break;
   case RCURLY:
-    fprintf(listing, "}\n");
+    fprintf(out, "}\n");
     break;
   case SEMI:
-    fprintf(listing, ";\n");
+    fprintf(out, ";\n");
     break;
   case COMMA:
-    fprintf(listing, ",\n");
+    fprintf(out, ",\n");
     break;
 
   case ENDFILE:
-    fprintf(listing, "EOF\n");
+    fprintf(out, "EOF\n");
     break;
   case NUM:
-    fprintf(listing,
-            "NUM, val= %s\n", tokenString);
+    fprintf(out,
+            "NUM, val= %.*s\n", len, text);
     break;
   case ID:
-    fprintf(listing,
-            "ID, name= %s\n", tokenString);
+    fprintf(out,
+            "ID, name= %.*s\n", len, text);
     break;
   case ERROR:
-    fprintf(listing,
-            "ERROR: %s\n", tokenString);
+    fprintf(out,
+            "ERROR: %.*s\n", len, text);
     break;
   default: /* should never happen */
-    fprintf(listing, "Unknown token: %d\n", token);
+    fprintf(out, "Unknown token: %d\n", token);
   }
 }
 
-/* Function newDclrKind creates a new declaration
- * node for syntax tree construction
+/* Procedure printToken prints a token and its
+ * lexeme, the len bytes at text, to the listing file
  */
-TreeNode *newDclrNode(DclrKind kind)
+void printToken(TokenType token, const char *text, int len)
 {
-  TreeNode *t = (TreeNode *)malloc(sizeof(TreeNode));
-  int i;
-  if (t == NULL)
-    fprintf(listing, "Out of memory error at line %d\n", lineno);
-  else
+  fprintToken(listing, token, text, len);
+}
+
+NodeTable *curTree = NULL;
+
+/* newNode adds a node of the given kind to tab, with
+ * no children, siblings or attributes, and returns
+ * it; it returns NULL if out of memory
+ */
+static TreeNode *newNode(NodeTable *tab, NodeKind nodekind)
+{
+  TreeNode *t;
+  if (tab->count == 0)
+    tab->count = 1; /* keep node 0 for NONODE */
+  if (tab->count >= tab->cap)
   {
-    for (i = 0; i < MAXCHILDREN; i++)
-      t->child[i] = NULL;
-    t->sibling = NULL;
-    t->lineno = lineno;
-    t->nodekind = DclrK;
-    t->kind.dclr = kind;
+    int cap = tab->cap == 0 ? 1024 : 2 * tab->cap;
+    TreeNode *node = realloc(tab->node, cap * sizeof(TreeNode));
+    if (node == NULL)
+    {
+      fprintf(listing, "Out of memory error at line %d\n", lineno);
+      return NULL;
+    }
+    memset(node, 0, sizeof(TreeNode)); /* the NONODE */
+    tab->node = node;
+    tab->cap = cap;
   }
+  t = tab->node + tab->count++;
+  memset(t, 0, sizeof(TreeNode));
+  t->attr.name = NOATOM;
+  t->nodekind = nodekind;
   return t;
 }
 
+/* Function newDclrKind creates a new declaration
+ * node for syntax tree construction
+ */
+NodeId newDclrNode(NodeTable *tab, DclrKind kind)
+{
+  TreeNode *t = newNode(tab, DclrK);
+  if (t == NULL)
+    return NONODE;
+  t->kind.dclr = kind;
+  return t - tab->node;
+}
+
 /* Function newParamNode creates a new parameter
  * node for syntax tree construction
  */
-TreeNode *newParamNode(ParamKind kind)
+NodeId newParamNode(NodeTable *tab, ParamKind kind)
 {
-  TreeNode *t = (TreeNode *)malloc(sizeof(TreeNode));
-  int i;
+  TreeNode *t = newNode(tab, ParamK);
   if (t == NULL)
-    fprintf(listing, "Out of memory error at line %d\n", lineno);
-  else
-  {
-    for (i = 0; i < MAXCHILDREN; i++)
-      t->child[i] = NULL;
-    t->sibling = NULL;
-    t->lineno = lineno;
-    t->nodekind = ParamK;
-    t->kind.prm = kind;
-  }
-  return t;
+    return NONODE;
+  t->kind.prm = kind;
+  return t - tab->node;
 }
 
 /* Function newStmtNode creates a new statement
  * node for syntax tree construction
  */
-TreeNode *newStmtNode(StmtKind kind)
+NodeId newStmtNode(NodeTable *tab, StmtKind kind)
 {
-  TreeNode *t = (TreeNode *)malloc(sizeof(TreeNode));
-  int i;
+  TreeNode *t = newNode(tab, StmtK);
   if (t == NULL)
-    fprintf(listing, "Out of memory error at line %d\n", lineno);
-  else
-  {
-    for (i = 0; i < MAXCHILDREN; i++)
-      t->child[i] = NULL;
-    t->sibling = NULL;
-    t->lineno = lineno;
-    t->nodekind = StmtK;
-    t->kind.stmt = kind;
-  }
-  return t;
+    return NONODE;
+  t->kind.stmt = kind;
+  return t - tab->node;
 }
 
 /* Function newExpNode creates a new expression
  * node for syntax tree construction
  */
-TreeNode *newExpNode(ExpKind kind)
+NodeId newExpNode(NodeTable *tab, ExpKind kind)
 {
-  TreeNode *t = (TreeNode *)malloc(sizeof(TreeNode));
-  int i;
+  TreeNode *t = newNode(tab, ExpK);
   if (t == NULL)
-    fprintf(listing, "Out of memory error at line %d\n", lineno);
-  else
-  {
-    for (i = 0; i < MAXCHILDREN; i++)
-      t->child[i] = NULL;
-    t->sibling = NULL;
-    t->lineno = lineno;
-    t->nodekind = ExpK;
-    t->kind.exp = kind;
-  }
-  return t;
+    return NONODE;
+  t->kind.exp = kind;
+  return t - tab->node;
+}
+
+void freeNodes(NodeTable *tab)
+{
+  if (curTree == tab)
+    curTree = NULL;
+  free(tab->node);
+  tab->node = NULL;
+  tab->count = tab->cap = 0;
 }
 
 /* Function copyString allocates and makes a new
@@ -224,150 +238,63 @@ char *copyString(char *s)
   return t;
 }
 
-/* Variable indentno is used by printTree to
- * store current number of spaces to indent
- */
-static indentno = 0;
-
-/* macros to increase/decrease indentation */
-#define INDENT indentno += 2
-#define UNINDENT indentno -= 2
-
-/* printSpaces indents by printing spaces */
-static void printSpaces(void)
+char *outputName(char *pgm, char *ext)
 {
-  int i;
-  for (i = 0; i < indentno; i++)
-    fprintf(listing, " ");
+  char *dot = strrchr(pgm, '.');
+  char *slash = strrchr(pgm, '/');
+  int fnlen = dot != NULL && (slash == NULL || dot > slash + 1)
+                  ? dot - pgm
+                  : (int)strlen(pgm);
+  char *name = (char *)calloc(fnlen + strlen(ext) + 1, sizeof(char));
+  if (name == NULL)
+  {
+    fprintf(stderr, "Out of memory\n");
+    exit(1);
+  }
+  strncpy(name, pgm, fnlen);
+  strcat(name, ext);
+  return name;
 }
 
-/* procedure printTree prints a syntax tree to the
- * listing file using indentation to indicate subtrees
+/* Function nodeAtom returns the name held by a
+ * syntax tree node, or NOATOM if it has none. Names
+ * share attr with operators and values, so only the
+ * kinds of node that carry a name may read it.
  */
-void printTree(TreeNode *tree)
+Atom nodeAtom(TreeNode *t)
 {
-  int i;
-  INDENT;
-  while (tree != NULL)
+  switch (t->nodekind)
   {
-    printSpaces();
-    if (tree->nodekind == StmtK)
-    {
-      switch (tree->kind.stmt)
-      {
-      case IfK:
-        fprintf(listing, "If Statement:\n");
-        break;
-      case ElseK:
-        fprintf(listing, "If-Else Statement:\n");
-        break;
-      case WhileK:
-        fprintf(listing, "While Statement:\n");
-        break;
-      case NonReturnK:
-        fprintf(listing, "Non-value Return Statement\n");
-        break;
-      case ReturnK:
-        fprintf(listing, "Return Statement:\n");
-        break;
-      case CompK:
-        fprintf(listing, "Compound Statement:\n");
-        break;
-      case AssignK:
-        fprintf(listing, "Assign:\n");
-        break;
-      default:
-        fprintf(listing, "Unknown ExpNode kind\n");
-        break;
-      }
-    }
-    else if (tree->nodekind == ExpK)
-    {
-      switch (tree->kind.exp)
-      {
-      case OpK:
-        fprintf(listing, "Op: ");
-        printToken(tree->attr.op, "\0");
-        break;
-      case ConstK:
-        fprintf(listing, "Const: %d\n", tree->attr.val);
-        break;
-      case IdK:
-        fprintf(listing, "Variable: name = %s\n", tree->attr.name);
-        break;
-      case ArrEK:
-        fprintf(listing, "Variable: name = %s\n", tree->attr.name);
-        break;
-      case CallK:
-        fprintf(listing, "Call: function name = %s\n", tree->attr.name);
-        break;
-      default:
-        fprintf(listing, "Unknown ExpNode kind\n");
-        break;
-      }
-    }
-    else if (tree->nodekind == DclrK)
-    {
-      char *type;
-      if (tree->type == Void)
-        type = "void";
-      else if (tree->type == Integer)
-        type = "int";
-      else if (tree->type == Null)
-        type = "null";
-      else
-        fprintf(listing, "Unknown ExpType\n");
-      switch (tree->kind.dclr)
-      {
-      case VarK:
-        fprintf(listing, "Variable Declaration: name = %s, type = %s\n", tree->attr.name, type);
-        break;
-      case ArrPK:
-        fprintf(listing, "Variable Declaration: name = %s, type = %s[]\n", tree->attr.name, type);
-        break;
-      case FuncK:
-        fprintf(listing, "Function Declaration: name = %s, return type = %s\n", tree->attr.name, type);
-        break;
-      case TypeK:
-        fprintf(listing, "Type Declaration: Don't Print\n");
-        break;
-      default:
-        fprintf(listing, "Unknown DclrNode kind\n");
-        break;
-      }
-    }
-    else if (tree->nodekind == ParamK)
-    {
-      char *type;
-      if (tree->type == Void)
-        type = "void";
-      else if (tree->type == Integer)
-        type = "int";
-      else if (tree->type == Null)
-        type = "null";
-      else
-        fprintf(listing, "Unknown ExpType\n");
-      switch (tree->kind.prm)
-      {
-      case NArrK:
-        fprintf(listing, "Parameter: name = %s, type = %s\n", tree->attr.name, type);
-        break;
-      case ArrPK:
-        fprintf(listing, "Parameter: name = %s, type = %s[]\n", tree->attr.name, type);
-        break;
-      case NullK:
-        fprintf(listing, "Void Parameter\n");
-        break;
-      default:
-        fprintf(listing, "Unknown ParamNode kind\n");
-        break;
-      }
-    }
-    else
-      fprintf(listing, "Unknown node kind\n");
-    for (i = 0; i < MAXCHILDREN; i++)
-      printTree(tree->child[i]);
-    tree = tree->sibling;
+  case DclrK:
+    return t->kind.dclr == TypeK ? NOATOM : t->attr.name;
+  case ParamK:
+    return t->attr.name;
+  case ExpK:
+    return t->kind.exp == IdK || t->kind.exp == ArrEK || t->kind.exp == CallK
+               ? t->attr.name
+               : NOATOM;
+  default:
+    return NOATOM;
   }
-  UNINDENT;
+}
+
+/* Function nodeName returns the name held by a
+ * syntax tree node, or NULL if it has none
+ */
+char *nodeName(TreeNode *t)
+{
+  return atomName(nodeAtom(t));
+}
+
+/* Functions nodeLine and nodeColumn locate a syntax
+ * tree node through the line index of curSource
+ */
+int nodeLine(TreeNode *t)
+{
+  return lineOf(curSource, t->pos);
+}
+
+int nodeColumn(TreeNode *t)
+{
+  return columnOf(curSource, t->pos);
 }
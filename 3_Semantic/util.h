@@ -8,39 +8,81 @@
 #ifndef _UTIL_H_
 #define _UTIL_H_
 
-/* Procedure printToken prints a token
- * and its lexeme to the listing file
+/* Procedure printToken prints a token and its
+ * lexeme, the len bytes at text, to the listing file
+ */
+void printToken(TokenType, const char *text, int len);
+
+/* Procedure fprintToken prints a token and its
+ * lexeme, the len bytes at text, to the given file.
+ * The lexeme is normally the token's span of the
+ * source, which is not NUL-terminated.
+ */
+void fprintToken(FILE *, TokenType, const char *text, int len);
+
+/* curTree is the node table the syntax tree handed
+ * to dumpTree and the analyzer lives in (see
+ * useCompilation), and NODE finds a node in it
+ */
+extern NodeTable *curTree;
+#define NODE(id) nodeIn(curTree, id)
+
+/* The node constructors below add a node to table
+ * tab, normally that of the compilation being parsed,
+ * and return its id. Adding a node may move the
+ * others, so hold on to ids rather than pointers
+ * while building a tree.
  */
-void printToken(TokenType, const char *);
 
 /* Function newDclrKind creates a new declaration
  * node for syntax tree construction
  */
-TreeNode *newDclrNode(DclrKind kind);
+NodeId newDclrNode(NodeTable *tab, DclrKind kind);
 
 /* Function newParamNode creates a new parameter
  * node for syntax tree construction
  */
-TreeNode *newParamNode(ParamKind kind);
+NodeId newParamNode(NodeTable *tab, ParamKind kind);
 
 /* Function newStmtNode creates a new statement
  * node for syntax tree construction
  */
-TreeNode *newStmtNode(StmtKind);
+NodeId newStmtNode(NodeTable *tab, StmtKind kind);
 
 /* Function newExpNode creates a new expression
  * node for syntax tree construction
  */
-TreeNode *newExpNode(ExpKind);
+NodeId newExpNode(NodeTable *tab, ExpKind kind);
+
+/* Procedure freeNodes releases every node of tab */
+void freeNodes(NodeTable *tab);
 
 /* Function copyString allocates and makes a new
  * copy of an existing string
  */
 char *copyString(char *);
 
-/* procedure printTree prints a syntax tree to the
- * listing file using indentation to indicate subtrees
+/* Function outputName returns the name of the file
+ * with extension ext that goes with source file pgm:
+ * pgm with its extension, from the last '.' in its
+ * last path component on, replaced by ext
+ */
+char *outputName(char *pgm, char *ext);
+
+/* Function nodeAtom returns the name held by a
+ * syntax tree node, or NOATOM if it has none
+ */
+Atom nodeAtom(TreeNode *);
+
+/* Function nodeName returns the name held by a
+ * syntax tree node, or NULL if it has none
+ */
+char *nodeName(TreeNode *);
+
+/* Functions nodeLine and nodeColumn return the line
+ * and column at which a syntax tree node starts
  */
-void printTree(TreeNode *);
+int nodeLine(TreeNode *);
+int nodeColumn(TreeNode *);
 
 #endif